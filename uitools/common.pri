@@ -16,17 +16,35 @@ CPPPATH = $$PWD/cpp/Esri/ArcGISRuntime/Toolkit
 
 INCLUDEPATH += $$PWD/cpp $$CPPPATH
 
+QT += concurrent
+
+# Uncomment to format latitude and longitude, UTM, MGRS and USNG notations of
+# WGS84 points with the toolkit's own formatters instead of the
+# CoordinateFormatter. Only do so once tests/CoordinateConversion passes
+# against the ArcGIS Runtime in use.
+# DEFINES += NATIVE_FORMATTERS_ARCGISRUNTIME_TOOLKIT
 
 HEADERS += $$CPPPATH/AuthenticationController.h \
            $$CPPPATH/CoordinateConversionConstants.h \
            $$CPPPATH/CoordinateConversionController.h \
            $$CPPPATH/CoordinateConversionOption.h \
            $$CPPPATH/CoordinateConversionResult.h \
+           $$CPPPATH/CoordinateFormatSpec.h \
            $$CPPPATH/CoordinateOptionDefaults.h \
+           $$CPPPATH/Internal/ConvertedPoint.h \
+           $$CPPPATH/Internal/ElementTypeInfo.h \
+           $$CPPPATH/Internal/GadgetListModel.h \
            $$CPPPATH/Internal/GenericListModel.h \
            $$CPPPATH/Internal/GenericTableProxyModel.h \
            $$CPPPATH/Internal/GeoViews.h \
-           $$CPPPATH/Internal/MetaElement.h \
+           $$CPPPATH/Internal/GridReferenceFormatter.h \
+           $$CPPPATH/Internal/LatitudeLongitudeFormatter.h \
+           $$CPPPATH/Internal/NotationCache.h \
+           $$CPPPATH/Internal/NotationClassifier.h \
+           $$CPPPATH/Internal/SignalDispatcher.h \
+           $$CPPPATH/Internal/TimeStepTable.h \
+           $$CPPPATH/Internal/TrackedPointsModel.h \
+           $$CPPPATH/Internal/TypedGenericListModel.h \
            $$CPPPATH/NorthArrowController.h \
            $$CPPPATH/PopupViewController.h \
            $$CPPPATH/TimeSliderController.h
@@ -36,10 +54,19 @@ SOURCES += $$CPPPATH/AuthenticationController.cpp \
            $$CPPPATH/CoordinateConversionController.cpp \
            $$CPPPATH/CoordinateConversionOption.cpp \
            $$CPPPATH/CoordinateConversionResult.cpp \
+           $$CPPPATH/CoordinateFormatSpec.cpp \
            $$CPPPATH/CoordinateOptionDefaults.cpp \
+           $$CPPPATH/Internal/ElementTypeInfo.cpp \
+           $$CPPPATH/Internal/GadgetListModel.cpp \
            $$CPPPATH/Internal/GenericListModel.cpp \
            $$CPPPATH/Internal/GenericTableProxyModel.cpp \
-           $$CPPPATH/Internal/MetaElement.cpp \
+           $$CPPPATH/Internal/GridReferenceFormatter.cpp \
+           $$CPPPATH/Internal/LatitudeLongitudeFormatter.cpp \
+           $$CPPPATH/Internal/NotationCache.cpp \
+           $$CPPPATH/Internal/NotationClassifier.cpp \
+           $$CPPPATH/Internal/SignalDispatcher.cpp \
+           $$CPPPATH/Internal/TimeStepTable.cpp \
+           $$CPPPATH/Internal/TrackedPointsModel.cpp \
            $$CPPPATH/NorthArrowController.cpp \
            $$CPPPATH/PopupViewController.cpp \
            $$CPPPATH/TimeSliderController.cpp
@@ -17,15 +17,28 @@
 
 // Toolkit headers
 #include "CoordinateConversionResult.h"
+#include "CoordinateFormatSpec.h"
 #include "CoordinateOptionDefaults.h"
+#include "Internal/ConvertedPoint.h"
 #include "Internal/GeoViews.h"
+#include "Internal/NotationCache.h"
+#include "Internal/NotationClassifier.h"
 
 // Qt headers
+#include <QEvent>
+#include <QFutureWatcher>
+#include <QMetaMethod>
+#include <QTimer>
+#include <QtConcurrent>
 #include <QtGlobal>
 
 // ArcGISRuntime headers
 #include <CoordinateFormatter.h>
 
+// std headers
+#include <algorithm>
+#include <cmath>
+
 namespace Esri
 {
 namespace ArcGISRuntime
@@ -36,6 +49,76 @@ namespace Toolkit
 namespace
 {
 constexpr double DEFAULT_ZOOM_TO_DISTANCE = 1500.0;
+constexpr int BATCH_CHUNK_SIZE = 1024;
+constexpr int DEFAULT_HOVER_UPDATE_INTERVAL = 16;
+
+using BatchResult = QVector<QStringList>;
+
+struct BatchChunk
+{
+  int begin = 0;
+  int end = 0;
+};
+
+// The spec of one column of a batch, which has none if its option was null.
+struct ColumnSpec
+{
+  bool isValid = false;
+  CoordinateFormatSpec spec;
+};
+
+// Converts one chunk of points into one column of notations per option.
+struct ConvertChunk
+{
+  using result_type = BatchResult;
+
+  QList<Point> points;
+  QVector<ColumnSpec> specs;
+  std::shared_ptr<NotationCache> cache;
+
+  BatchResult operator()(const BatchChunk& chunk) const
+  {
+    const auto chunkPoints = points.mid(chunk.begin, chunk.end - chunk.begin);
+    BatchResult columns;
+    columns.reserve(specs.size());
+    for (const auto& column : specs)
+      columns.append(column.isValid ? formatCoordinates(column.spec, chunkPoints, *cache) : QStringList());
+
+    return columns;
+  }
+};
+
+// Converts the pending points of one column of the tracked points.
+struct ConvertTracked
+{
+  using result_type = QStringList;
+
+  QHash<int, CoordinateFormatSpec> specs;
+  std::shared_ptr<NotationCache> cache;
+
+  QStringList operator()(const TrackedPointsModel::Conversion& conversion) const
+  {
+    const auto it = specs.constFind(conversion.column);
+    return it != specs.cend() ? formatCoordinates(*it, conversion.points, *cache) : QStringList();
+  }
+};
+
+// Appends the columns of each chunk, in input order, onto the final columns.
+struct AppendChunk
+{
+  void operator()(BatchResult& result, const BatchResult& chunk) const
+  {
+    if (result.isEmpty())
+    {
+      result = chunk;
+      return;
+    }
+
+    for (int i = 0; i < chunk.size(); ++i)
+      result[i].append(chunk.at(i));
+  }
+};
+
 }
 
 /*!  
@@ -59,6 +142,14 @@ constexpr double DEFAULT_ZOOM_TO_DISTANCE = 1500.0;
     \li The controller to calculate the screen coordinate of the current 
         point relative to the window containing the GeoView.
   \endlist
+
+  Alongside the current point, the controller can track any number of
+  moving points, such as a fleet of vehicles, identified by stable ids.
+  Their notations are held in \l trackedPoints, a table with one row per
+  point and one column per format in \l conversionResults. Tracked points
+  are updated in bulk with \l updateTrackedPoints and converted off the GUI
+  thread. A point is only converted again for the formats whose precision
+  it moved beyond.
  */
 
 /*!
@@ -71,7 +162,12 @@ CoordinateConversionController::CoordinateConversionController(QObject* parent):
   QObject(parent),
   m_zoomToDistance(DEFAULT_ZOOM_TO_DISTANCE),
   m_coordinateFormats(new GenericListModel(&CoordinateConversionOption::staticMetaObject, this)),
-  m_conversionResults(new GenericListModel(&CoordinateConversionResult::staticMetaObject, this))
+  m_conversionResults(new GenericListModel(&CoordinateConversionResult::staticMetaObject, this)),
+  m_batchResults(new GadgetListModel(&ConvertedPoint::staticMetaObject, qMetaTypeId<ConvertedPoint>(), this)),
+  m_hoverTimer(new QTimer(this)),
+  m_refreshWatcher(new QFutureWatcher<BatchResult>(this)),
+  m_notationCache(std::make_shared<NotationCache>()),
+  m_trackedPoints(new TrackedPointsModel(this))
 {
   {
     // Some default coordinate conversion formats to set us up with.
@@ -87,29 +183,56 @@ CoordinateConversionController::CoordinateConversionController(QObject* parent):
     );
   }
 
+  {
+    // formatsMatching groups the formats by output mode, which is redone
+    // when they next change.
+    connect(m_coordinateFormats, &QAbstractItemModel::rowsInserted,
+            this, &CoordinateConversionController::invalidateFormatsByMode);
+    connect(m_coordinateFormats, &QAbstractItemModel::rowsRemoved,
+            this, &CoordinateConversionController::invalidateFormatsByMode);
+    connect(m_coordinateFormats, &QAbstractItemModel::rowsMoved,
+            this, &CoordinateConversionController::invalidateFormatsByMode);
+    connect(m_coordinateFormats, &QAbstractItemModel::modelReset,
+            this, &CoordinateConversionController::invalidateFormatsByMode);
+    connect(m_coordinateFormats, &QAbstractItemModel::dataChanged,
+            this, &CoordinateConversionController::invalidateFormatsByMode);
+  }
+
   {
     m_conversionResults->setDisplayPropertyName("name");
-    connect(m_conversionResults, &QAbstractItemModel::rowsInserted, this,
-      [this](const QModelIndex& /*parent*/, int first, int last)
-      {
-        // Every result owned by the controller needs to listen to the
-        // currentPointChanged signal to update its notation.
-        for (int i = first; i <= last; ++i)
-        {
-          auto index = m_conversionResults->index(i);
-          auto result = m_conversionResults->element<CoordinateConversionResult>(index);
-          if (result)
-          {
-            connect(this, &CoordinateConversionController::currentPointChanged,
-                    result, &CoordinateConversionResult::updateCoordinatePoint);
-          }
-          else
-          {
-            qWarning("Empty CoordinateConversionResult in the CoordinateConversionController results model at index %d", i);
-          }
-        }
-      }
-     );
+
+    // A new current point updates the notation of every result at once, so
+    // merge the resulting notifications into as few dataChanged as possible.
+    m_conversionResults->setBatchingEnabled(true);
+
+    // Notations for a new current point are computed off the GUI thread.
+    connect(m_refreshWatcher, &QFutureWatcherBase::finished,
+            this, &CoordinateConversionController::refreshFinished);
+  }
+
+  {
+    // The tracked points have one column per result type.
+    connect(m_conversionResults, &QAbstractItemModel::rowsInserted,
+            this, &CoordinateConversionController::syncTrackedFormats);
+    connect(m_conversionResults, &QAbstractItemModel::rowsRemoved,
+            this, &CoordinateConversionController::syncTrackedFormats);
+    connect(m_conversionResults, &QAbstractItemModel::modelReset,
+            this, &CoordinateConversionController::syncTrackedFormats);
+    connect(m_conversionResults, &QAbstractItemModel::dataChanged,
+            this, &CoordinateConversionController::syncTrackedFormats);
+
+    // Queued, so that all updates made in one pass of the event loop are
+    // converted together.
+    connect(m_trackedPoints, &TrackedPointsModel::conversionRequired,
+            this, &CoordinateConversionController::refreshTrackedPoints, Qt::QueuedConnection);
+  }
+
+  {
+    // While hovering, the timer limits lookups to one per interval. The
+    // latest position seen during an interval is looked up when it ends.
+    m_hoverTimer->setSingleShot(true);
+    m_hoverTimer->setInterval(DEFAULT_HOVER_UPDATE_INTERVAL);
+    connect(m_hoverTimer, &QTimer::timeout, this, &CoordinateConversionController::updateHoverPoint);
   }
 }
 
@@ -120,6 +243,401 @@ CoordinateConversionController::~CoordinateConversionController()
 {
 }
 
+/*!
+  \brief Returns the options in \l coordinateFormats whose notation \a text
+  may be written in, most likely first.
+
+  The notation is guessed from the shape of \a text by a
+  \c NotationClassifier, without calling the \c CoordinateFormatter, so
+  this is cheap enough to call on every keystroke. Text which is valid in
+  more than one notation returns options for each of them. The formats are
+  grouped by output mode once, and again only after \l coordinateFormats
+  changes.
+
+  \list
+    \li \a text Coordinate text of unknown notation.
+  \endlist
+ */
+QList<CoordinateConversionOption*> CoordinateConversionController::formatsMatching(const QString& text) const
+{
+  if (m_formatsByModeDirty)
+  {
+    m_formatsByMode.clear();
+    const int count = m_coordinateFormats->rowCount();
+    for (int i = 0; i < count; ++i)
+    {
+      auto option = m_coordinateFormats->element<CoordinateConversionOption>(m_coordinateFormats->index(i));
+      if (option)
+        m_formatsByMode[static_cast<int>(option->outputMode())].append(option);
+    }
+    m_formatsByModeDirty = false;
+  }
+
+  QList<CoordinateConversionOption*> matching;
+  const auto types = NotationClassifier::classify(text);
+  for (const auto type : types)
+  {
+    const auto it = m_formatsByMode.constFind(static_cast<int>(type));
+    if (it == m_formatsByMode.cend())
+      continue;
+
+    for (const auto& option : *it)
+    {
+      if (option)
+        matching.append(option);
+    }
+  }
+  return matching;
+}
+
+/*!
+  \brief Returns \a text, in any notation of \l coordinateFormats, as a
+  point in \a spatialReference.
+
+  Only the options returned by \l formatsMatching are tried, in order, so
+  text in an unknown notation fails without calling the
+  \c CoordinateFormatter. Returns an empty point if no option parses
+  \a text.
+
+  \list
+    \li \a text Coordinate text of unknown notation.
+    \li \a spatialReference The SpatialReference of the returned point.
+  \endlist
+ */
+Point CoordinateConversionController::pointFromText(const QString& text, const SpatialReference& spatialReference)
+{
+  const auto options = formatsMatching(text);
+  for (auto option : options)
+  {
+    const auto point = option->pointFromString(text, spatialReference);
+    if (point.isValid())
+      return point;
+  }
+  return Point();
+}
+
+/*!
+  \brief Converts every point in \a points into the notation of every option
+  in \a options on the global thread pool.
+
+  The points are split into chunks of 1024 which are converted concurrently.
+  The result is column-oriented: it holds one \c QStringList per option, in
+  the order of \a options, and each list holds one notation per point, in
+  the order of \a points. If \a points is empty the result is empty. The
+  column of a null option is empty, so the columns still line up with
+  \a options.
+
+  The formatting properties of each option are captured as a
+  \c CoordinateFormatSpec when this function is called, so the options may
+  be edited or deleted while the conversion runs. A single point is looked up
+  in a notation cache keyed on the spec, so refreshing the results for an
+  unchanged point does not convert it again. Several points bypass the cache.
+
+  The returned \c QFuture can be watched with a \c QFutureWatcher. Its
+  progress advances once per completed chunk and \c finished is emitted when
+  the result is ready. Cancelling the future stops any chunks which have not
+  started yet.
+
+  \list
+    \li \a points The points to convert.
+    \li \a options The options to convert each point with.
+  \endlist
+
+  Returns a future holding one column of notations per option.
+ */
+QFuture<QVector<QStringList>> CoordinateConversionController::convertBatch(
+  const QList<Point>& points,
+  const QList<CoordinateConversionOption*>& options)
+{
+  // Specs are plain values, so the thread pool never touches the options.
+  // The cache is keyed on the spec and shared with the workers instead.
+  ConvertChunk convert;
+  convert.points = points;
+  convert.cache = m_notationCache;
+  convert.specs.reserve(options.size());
+  for (auto option : options)
+  {
+    ColumnSpec column;
+    if (option)
+    {
+      column.isValid = true;
+      column.spec = option->spec();
+    }
+    convert.specs.append(column);
+  }
+
+  QVector<BatchChunk> chunks;
+  chunks.reserve(points.size() / BATCH_CHUNK_SIZE + 1);
+  for (int begin = 0; begin < points.size(); begin += BATCH_CHUNK_SIZE)
+  {
+    BatchChunk chunk;
+    chunk.begin = begin;
+    chunk.end = std::min(begin + BATCH_CHUNK_SIZE, points.size());
+    chunks.append(chunk);
+  }
+
+  return QtConcurrent::mappedReduced<BatchResult>(
+        chunks, convert, AppendChunk(),
+        QtConcurrent::OrderedReduce | QtConcurrent::SequentialReduce);
+}
+
+/*!
+  \brief Converts every point in \a points into the notation of every option
+  in \a options as \l convertBatch does, and replaces the contents of
+  \l batchResults with the converted points once they are ready.
+
+  If this is called again before the conversion finishes, only the latest
+  conversion is shown.
+
+  \list
+    \li \a points The points to convert.
+    \li \a options The options to convert each point with.
+  \endlist
+
+  Returns a future holding one column of notations per option.
+ */
+QFuture<QVector<QStringList>> CoordinateConversionController::convertBatchToResults(
+  const QList<Point>& points,
+  const QList<CoordinateConversionOption*>& options)
+{
+  const quint64 generation = ++m_batchGeneration;
+  const auto future = convertBatch(points, options);
+
+  auto watcher = new QFutureWatcher<BatchResult>(this);
+  connect(watcher, &QFutureWatcherBase::finished, this, [this, watcher, generation, points]
+  {
+    watcher->deleteLater();
+
+    const auto future = watcher->future();
+    if (generation != m_batchGeneration || future.isCanceled() || future.resultCount() < 1)
+      return;
+
+    const auto columns = future.result();
+    QVariantList rows;
+    rows.reserve(points.size());
+    for (int i = 0; i < points.size(); ++i)
+    {
+      ConvertedPoint row;
+      row.x = points.at(i).x();
+      row.y = points.at(i).y();
+      row.notations.reserve(columns.size());
+      for (const auto& column : columns)
+        row.notations.append(column.value(i));
+
+      rows.append(QVariant::fromValue(row));
+    }
+
+    m_batchResults->removeRows(0, m_batchResults->rowCount());
+    m_batchResults->append(rows);
+  });
+
+  watcher->setFuture(future);
+  return future;
+}
+
+/*!
+  \internal
+  \brief Requests that the notation of every result is recomputed for the
+  current point.
+
+  Each request advances a generation counter. At most one refresh runs at a
+  time; a request made while one is running is picked up when it finishes,
+  and the results of the superseded refresh are dropped. Rapid updates
+  therefore only ever convert the most recent point.
+ */
+void CoordinateConversionController::refreshResults()
+{
+  ++m_refreshGeneration;
+  if (!m_refreshing)
+    startRefresh();
+}
+
+/*!
+  \internal
+  \brief Starts converting the current point for every result with a type.
+ */
+void CoordinateConversionController::startRefresh()
+{
+  m_runningGeneration = m_refreshGeneration;
+  m_refreshTargets.clear();
+
+  QList<CoordinateConversionOption*> options;
+  const int count = m_conversionResults->rowCount();
+  for (int i = 0; i < count; ++i)
+  {
+    auto result = m_conversionResults->element<CoordinateConversionResult>(m_conversionResults->index(i));
+    if (!result)
+      continue;
+
+    if (auto option = result->type())
+    {
+      m_refreshTargets.append({ result, option });
+      options.append(option);
+    }
+    else
+    {
+      result->setNotation("");
+    }
+  }
+
+  if (m_refreshTargets.isEmpty())
+    return;
+
+  m_refreshing = true;
+  m_refreshWatcher->setFuture(convertBatch({ m_currentPoint }, options));
+}
+
+/*!
+  \internal
+  \brief Applies the notations of a finished refresh, or starts a new one if
+  the current point changed while it was running.
+
+  Results which were removed, or whose type changed, in the meantime are
+  skipped. The changes are flushed from the results model as one batch.
+ */
+void CoordinateConversionController::refreshFinished()
+{
+  m_refreshing = false;
+
+  if (m_runningGeneration != m_refreshGeneration)
+  {
+    startRefresh();
+    return;
+  }
+
+  const auto future = m_refreshWatcher->future();
+  if (future.isCanceled() || future.resultCount() < 1)
+    return;
+
+  const auto columns = future.result();
+  for (int i = 0; i < m_refreshTargets.size() && i < columns.size(); ++i)
+  {
+    const auto& target = m_refreshTargets.at(i);
+    if (target.result && target.option && target.result->type() == target.option)
+      target.result->setNotation(columns.at(i).value(0));
+  }
+  m_refreshTargets.clear();
+  m_conversionResults->flush();
+}
+
+/*!
+  \internal
+  \brief Makes the columns of the tracked points follow the types of the
+  conversion results.
+ */
+void CoordinateConversionController::syncTrackedFormats()
+{
+  QList<CoordinateConversionOption*> options;
+  const int count = m_conversionResults->rowCount();
+  for (int i = 0; i < count; ++i)
+  {
+    auto result = m_conversionResults->element<CoordinateConversionResult>(m_conversionResults->index(i));
+    if (result && result->type())
+      options.append(result->type());
+  }
+  m_trackedPoints->setOptions(options);
+}
+
+/*!
+  \internal
+  \brief Marks the grouping of \l coordinateFormats by output mode, used by
+  \l formatsMatching, as out of date.
+ */
+void CoordinateConversionController::invalidateFormatsByMode()
+{
+  m_formatsByModeDirty = true;
+}
+
+/*!
+  \internal
+  \brief Converts every pending tracked point on the global thread pool.
+
+  At most one conversion of tracked points runs at a time. Points which
+  move while it runs are converted by the next one, which starts as soon
+  as it finishes, so updates arriving faster than they can be converted are
+  coalesced rather than queued.
+ */
+void CoordinateConversionController::refreshTrackedPoints()
+{
+  if (m_trackedRefreshing)
+    return;
+
+  const auto conversions = m_trackedPoints->takePendingConversions(BATCH_CHUNK_SIZE);
+  if (conversions.isEmpty())
+    return;
+
+  ConvertTracked convert;
+  convert.cache = m_notationCache;
+  for (const auto& conversion : conversions)
+  {
+    if (!convert.specs.contains(conversion.column))
+      convert.specs.insert(conversion.column, conversion.option->spec());
+  }
+
+  auto watcher = new QFutureWatcher<QStringList>(this);
+  connect(watcher, &QFutureWatcherBase::finished, this, [this, watcher, conversions]
+  {
+    m_trackedRefreshing = false;
+    watcher->deleteLater();
+
+    const auto future = watcher->future();
+    if (future.isCanceled())
+      return;
+
+    m_trackedPoints->applyConversions(conversions, QVector<QStringList>::fromList(future.results()));
+    if (m_trackedPoints->hasPendingConversions())
+      refreshTrackedPoints();
+  });
+
+  m_trackedRefreshing = true;
+  watcher->setFuture(QtConcurrent::mapped(conversions, convert));
+}
+
+/*!
+  \internal
+  \brief Records \a position as the latest hover position, and looks it up
+  straight away unless a lookup was made less than
+  \l hoverUpdateInterval ago.
+ */
+void CoordinateConversionController::queueHoverPosition(const QPointF& position)
+{
+  m_hoverPosition = position;
+  m_hoverPending = true;
+  if (!m_hoverTimer->isActive())
+    updateHoverPoint();
+}
+
+/*!
+  \internal
+  \brief Sets the current point to the location under the latest hover
+  position, if there is one which has not been looked up yet.
+
+  On a \c SceneView the lookup is asynchronous, and only one runs at a
+  time. Positions which arrive while it runs replace each other, and only
+  the last one is looked up once it completes.
+ */
+void CoordinateConversionController::updateHoverPoint()
+{
+  if (!m_hoverPending || !m_inHoverMode)
+    return;
+
+  if (auto sceneView = qobject_cast<SceneViewToolkit*>(m_geoView))
+  {
+    if (m_hoverTask.isValid() && !m_hoverTask.isDone())
+      return;
+
+    m_hoverPending = false;
+    m_hoverTimer->start();
+    m_hoverTask = sceneView->screenToLocation(m_hoverPosition.x(), m_hoverPosition.y());
+  }
+  else if (auto mapView = qobject_cast<MapViewToolkit*>(m_geoView))
+  {
+    m_hoverPending = false;
+    m_hoverTimer->start();
+    setCurrentPoint(mapView->screenToLocation(m_hoverPosition.x(), m_hoverPosition.y()));
+  }
+}
+
 /*!
   \brief Returns the \c GeoView as a \c QObject.
  */
@@ -145,9 +663,15 @@ void CoordinateConversionController::setGeoView(QObject* geoView)
     return;
 
   if (m_geoView)
-    disconnect(this, nullptr, m_geoView, nullptr);
+  {
+    disconnect(m_geoView, nullptr, this, nullptr);
+    m_geoView->removeEventFilter(this);
+  }
 
   m_geoView = geoView;
+  m_hoverPending = false;
+  m_hoverTask = TaskWatcher();
+  invalidateScreenCoordinate();
 
   if (auto sceneView = qobject_cast<SceneViewToolkit*>(m_geoView))
   {
@@ -162,9 +686,31 @@ void CoordinateConversionController::setGeoView(QObject* geoView)
       }
     });
 
+    connect(sceneView, &SceneViewToolkit::mouseMoved, this,
+            [this](QMouseEvent& event)
+    {
+      if (m_inHoverMode)
+        queueHoverPosition(QPointF(event.x(), event.y()));
+    });
+
+    connect(sceneView, &SceneViewToolkit::viewpointChanged,
+            this, &CoordinateConversionController::invalidateScreenCoordinate);
+
     connect(sceneView, &SceneViewToolkit::screenToLocationCompleted, this,
             [this](QUuid taskId, Point point)
     {
+      if (m_hoverTask.isValid() && taskId == m_hoverTask.taskId())
+      {
+        setCurrentPoint(point);
+
+        // A position which arrived while this lookup ran is looked up now,
+        // unless the interval has not elapsed yet.
+        if (!m_hoverTimer->isActive())
+          updateHoverPoint();
+
+        return;
+      }
+
       if (taskId != m_screenToLocationTask.taskId())
         return;
 
@@ -182,7 +728,32 @@ void CoordinateConversionController::setGeoView(QObject* geoView)
         event.accept();
       }
     });
+
+    connect(mapView, &MapViewToolkit::mouseMoved, this,
+            [this](QMouseEvent& event)
+    {
+      if (m_inHoverMode)
+        queueHoverPosition(QPointF(event.x(), event.y()));
+    });
+
+    connect(mapView, &MapViewToolkit::viewpointChanged,
+            this, &CoordinateConversionController::invalidateScreenCoordinate);
+  }
+
+  // Resizing the view moves the projected point and the edge it is pinned to.
+#ifdef WIDGETS_ARCGISRUNTIME_TOOLKIT
+  // Graphics views have no size signals, so resizes are caught in eventFilter.
+  if (m_geoView)
+    m_geoView->installEventFilter(this);
+#else
+  if (auto item = qobject_cast<QQuickItem*>(m_geoView))
+  {
+    connect(item, &QQuickItem::widthChanged,
+            this, &CoordinateConversionController::invalidateScreenCoordinate);
+    connect(item, &QQuickItem::heightChanged,
+            this, &CoordinateConversionController::invalidateScreenCoordinate);
   }
+#endif
 
   emit geoViewChanged();
 }
@@ -192,6 +763,9 @@ void CoordinateConversionController::setGeoView(QObject* geoView)
   \brief Set the current point to \a point. This updates all textual
   representations owned by this controller.
 
+  The notations of the results are recomputed asynchronously and applied
+  together once they are all ready.
+
   \list
   \li \a point new point to convert.
   \endlist
@@ -202,7 +776,9 @@ void CoordinateConversionController::setCurrentPoint(const Point& point)
     return;
 
   m_currentPoint = point;
+  invalidateScreenCoordinate();
   emit currentPointChanged(point);
+  refreshResults();
 }
 
 /*!
@@ -260,35 +836,158 @@ void CoordinateConversionController::setCurrentPoint(
 /*!
   \brief Converts the current point held by this controller as a 2D point 
   relative to the current window.
+
+  If the current point is outside the view, it is pinned to the edge of the
+  view in the direction of the point, so overlays can indicate where it
+  lies. Use \l isCurrentPointOnScreen to tell the two cases apart.
+
+  The projection is cached until the viewpoint, the size of the view or the
+  current point changes, so calling this repeatedly while the view animates
+  projects the point at most once per frame.
   
-  Returns the point returned by currentPoint as a screen coordinate. 
+  Returns the point returned by currentPoint as a screen coordinate, or
+  \c{(-1, -1)} if it cannot be projected.
  */
 QPointF CoordinateConversionController::screenCoordinate() const
 {
-  // TODO additional work required here to show a coordinate on the "edge" of
-  // the screen if coordinate is not in the current view.
-  QPointF res(-1.0, -1.0);
-  if (auto sceneView = qobject_cast<SceneView*>(m_geoView))
+  updateScreenCoordinate();
+  if (!m_hasScreenCoordinate)
+    return QPointF(-1.0, -1.0);
+
+  const auto bounds = screenBounds();
+  if (!m_screenCoordinateHidden && bounds.contains(m_screenCoordinate))
+    return m_screenCoordinate;
+
+  // Move the point towards the center of the view until it meets the edge.
+  const auto center = bounds.center();
+  const auto offset = m_screenCoordinate - center;
+  double scale = 1.0;
+  if (offset.x() != 0.0)
+    scale = std::min(scale, (bounds.width() / 2.0) / std::abs(offset.x()));
+  if (offset.y() != 0.0)
+    scale = std::min(scale, (bounds.height() / 2.0) / std::abs(offset.y()));
+
+  return center + offset * scale;
+}
+
+/*!
+  \brief Returns whether the current point is inside the view.
+
+  When this is \c false, \l screenCoordinate returns the point on the edge
+  of the view closest in direction to the current point.
+ */
+bool CoordinateConversionController::isCurrentPointOnScreen() const
+{
+  updateScreenCoordinate();
+  return m_hasScreenCoordinate && !m_screenCoordinateHidden &&
+         screenBounds().contains(m_screenCoordinate);
+}
+
+/*!
+  \internal
+  \brief Invalidates the screen coordinate when the \l geoView that
+  \a watched is set to receives a resize \a event.
+ */
+bool CoordinateConversionController::eventFilter(QObject* watched, QEvent* event)
+{
+  if (watched == m_geoView && event->type() == QEvent::Resize)
+    invalidateScreenCoordinate();
+
+  return QObject::eventFilter(watched, event);
+}
+
+/*!
+  \internal
+  \brief Discards the cached screen coordinate of the current point, after
+  the viewpoint, the size of the view or the current point changed.
+
+  The point is only projected again when it is next read. If
+  \l screenCoordinateChanged is connected, the point is projected now
+  instead, and the signal is skipped if neither the screen coordinate nor
+  whether the point is on screen changed since it was last emitted.
+ */
+void CoordinateConversionController::invalidateScreenCoordinate()
+{
+  m_screenCoordinateDirty = true;
+
+  static const auto changedSignal =
+      QMetaMethod::fromSignal(&CoordinateConversionController::screenCoordinateChanged);
+  if (!isSignalConnected(changedSignal))
   {
-    const auto location = sceneView->locationToScreen(m_currentPoint);
-    const auto lx = location.screenPoint().x();
-    const auto ly = location.screenPoint().y();
+    m_hasNotifiedScreenCoordinate = false;
+    emit screenCoordinateChanged();
+    return;
+  }
 
-    if (location.visibility() == SceneLocationVisibility::NotOnScreen)
-    {
-      // TODO attach to edge of screen.
-    }
-    else
-    {
-      res = QPointF(lx, ly);
-    }
+  const auto coordinate = screenCoordinate();
+  const bool onScreen = isCurrentPointOnScreen();
+  if (m_hasNotifiedScreenCoordinate && coordinate == m_notifiedScreenCoordinate &&
+      onScreen == m_notifiedOnScreen)
+  {
+    return;
+  }
+
+  m_hasNotifiedScreenCoordinate = true;
+  m_notifiedScreenCoordinate = coordinate;
+  m_notifiedOnScreen = onScreen;
+  emit screenCoordinateChanged();
+}
+
+/*!
+  \internal
+  \brief Projects the current point onto the view, unless the cached
+  projection is still current.
+ */
+void CoordinateConversionController::updateScreenCoordinate() const
+{
+  if (!m_screenCoordinateDirty)
+    return;
+
+  m_screenCoordinateDirty = false;
+  m_hasScreenCoordinate = false;
+  m_screenCoordinateHidden = false;
+
+  if (m_currentPoint.isEmpty())
+    return;
+
+  QPointF location;
+  if (auto sceneView = qobject_cast<SceneView*>(m_geoView))
+  {
+    const auto result = sceneView->locationToScreen(m_currentPoint);
+    location = result.screenPoint();
+    m_screenCoordinateHidden = result.visibility() == SceneLocationVisibility::NotOnScreen;
   }
   else if (auto mapView = qobject_cast<MapView*>(m_geoView))
   {
-    res = mapView->locationToScreen(m_currentPoint);
+    location = mapView->locationToScreen(m_currentPoint);
+  }
+  else
+  {
+    return;
   }
 
-  return res;
+  if (!std::isfinite(location.x()) || !std::isfinite(location.y()))
+    return;
+
+  m_screenCoordinate = location;
+  m_hasScreenCoordinate = true;
+}
+
+/*!
+  \internal
+  \brief Returns the bounds of the view in screen coordinates.
+
+  The size of the view is read on every call, so the pinned screen
+  coordinate follows the view as it is resized without projecting again.
+ */
+QRectF CoordinateConversionController::screenBounds() const
+{
+  if (auto sceneView = qobject_cast<SceneViewToolkit*>(m_geoView))
+    return QRectF(0.0, 0.0, sceneView->width(), sceneView->height());
+  else if (auto mapView = qobject_cast<MapViewToolkit*>(m_geoView))
+    return QRectF(0.0, 0.0, mapView->width(), mapView->height());
+
+  return QRectF();
 }
 
 /*!
@@ -327,6 +1026,61 @@ GenericListModel* CoordinateConversionController::conversionResults() const
   return m_conversionResults;
 }
 
+/*!
+  \brief Returns the points converted by the latest
+  \l convertBatchToResults, with one row per point.
+
+  Internally, this is a \c GadgetListModel of \c ConvertedPoint values.
+  Rows are stored column-wise rather than as one \c QObject each, so large
+  batches stay cheap to hold. The \c x and \c y roles hold the position of
+  the point, and the \c notations role holds its notation in each format.
+ */
+GadgetListModel* CoordinateConversionController::batchResults() const
+{
+  return m_batchResults;
+}
+
+/*!
+  \brief Returns the notations of the tracked points, with one row per point
+  and one column per type in \l conversionResults.
+
+  Internally, this is a \c TrackedPointsModel. Each cell's display role is a
+  notation. The \c pointId and \c point roles hold the id and position of the
+  point in that row.
+ */
+TrackedPointsModel* CoordinateConversionController::trackedPoints() const
+{
+  return m_trackedPoints;
+}
+
+/*!
+  \brief Sets the position of each point in \a points, keyed by a stable id.
+  Points with ids which are not tracked yet are added.
+
+  Notations are converted asynchronously, and only for the formats whose
+  precision a point moved beyond since it was last converted.
+ */
+void CoordinateConversionController::updateTrackedPoints(const QHash<qint64, Point>& points)
+{
+  m_trackedPoints->updatePoints(points);
+}
+
+/*!
+  \brief Stops tracking the points with the given \a ids.
+ */
+void CoordinateConversionController::removeTrackedPoints(const QList<qint64>& ids)
+{
+  m_trackedPoints->removePoints(ids);
+}
+
+/*!
+  \brief Stops tracking all points.
+ */
+void CoordinateConversionController::clearTrackedPoints()
+{
+  m_trackedPoints->clear();
+}
+
 /*!
  \brief Updates the \c GeoView camera to point to the current point's
  location on the map.
@@ -458,6 +1212,72 @@ void CoordinateConversionController::setInPickingMode(bool mode)
   emit inPickingModeChanged();
 }
 
+/*!
+  \brief Returns whether the current point follows the mouse cursor over the
+  \c GeoView.
+
+  In hover mode, every mouse move over the \c GeoView updates the current
+  point to the location under the cursor. Moves are coalesced: at most one
+  location is looked up per \l hoverUpdateInterval, always for the most
+  recent position, and on a \c SceneView a new lookup is only made once the
+  previous one has completed. Each lookup updates all results in one batch.
+
+  The \c GeoView only reports mouse moves without a pressed button if it
+  accepts hover events, or has mouse tracking enabled for widgets.
+
+  Defaults to \c false.
+ */
+bool CoordinateConversionController::inHoverMode() const
+{
+  return m_inHoverMode;
+}
+
+/*!
+  \brief Set whether the current point follows the mouse cursor to \a mode.
+
+  \sa inHoverMode
+ */
+void CoordinateConversionController::setInHoverMode(bool mode)
+{
+  if (m_inHoverMode == mode)
+    return;
+
+  m_inHoverMode = mode;
+  if (!m_inHoverMode)
+  {
+    m_hoverPending = false;
+    m_hoverTimer->stop();
+  }
+  emit inHoverModeChanged();
+}
+
+/*!
+  \brief Returns the minimum time in milliseconds between two locations
+  looked up in hover mode.
+
+  Defaults to 16, about one frame at 60Hz.
+ */
+int CoordinateConversionController::hoverUpdateInterval() const
+{
+  return m_hoverTimer->interval();
+}
+
+/*!
+  \brief Set the minimum time between two hover lookups to \a interval
+  milliseconds.
+
+  \sa hoverUpdateInterval
+ */
+void CoordinateConversionController::setHoverUpdateInterval(int interval)
+{
+  interval = std::max(0, interval);
+  if (interval == m_hoverTimer->interval())
+    return;
+
+  m_hoverTimer->setInterval(interval);
+  emit hoverUpdateIntervalChanged();
+}
+
 /*! 
   \fn void Esri::ArcGISRuntime::Toolkit::CoordinateConversionController::geoViewChanged()
   \brief Emitted when the geoView has changed.
@@ -468,6 +1288,12 @@ void CoordinateConversionController::setInPickingMode(bool mode)
   \brief Emitted when the currentPoint has changed. \a point represents the new point.
  */
 
+/*!
+  \fn void Esri::ArcGISRuntime::Toolkit::CoordinateConversionController::screenCoordinateChanged()
+  \brief Emitted when the viewpoint, the view or the current point changed,
+  so the result of \l screenCoordinate may have changed.
+ */
+
 /*!
   \fn void Esri::ArcGISRuntime::Toolkit::CoordinateConversionController::zoomToDistanceChanged()
   \brief Emitted when the zoomToDistance property has changed.
@@ -478,6 +1304,16 @@ void CoordinateConversionController::setInPickingMode(bool mode)
   \brief Emitted when the inPickingMode property has changed.
  */
 
+/*!
+  \fn void Esri::ArcGISRuntime::Toolkit::CoordinateConversionController::inHoverModeChanged()
+  \brief Emitted when the inHoverMode property has changed.
+ */
+
+/*!
+  \fn void Esri::ArcGISRuntime::Toolkit::CoordinateConversionController::hoverUpdateIntervalChanged()
+  \brief Emitted when the hoverUpdateInterval property has changed.
+ */
+
 /*!
   \property Esri::ArcGISRuntime::Toolkit::CoordinateConversionController::geoView
   \brief The geoview the controller is utilizing for interactions.
@@ -502,6 +1338,12 @@ void CoordinateConversionController::setInPickingMode(bool mode)
   \sa Esri::ArcGISRuntime::Toolkit::CoordinateConversionController::conversionResults()
  */
 
+/*!
+  \property Esri::ArcGISRuntime::Toolkit::CoordinateConversionController::trackedPoints
+  \brief Table of notations of all tracked points held by this controller.
+  \sa Esri::ArcGISRuntime::Toolkit::CoordinateConversionController::trackedPoints()
+ */
+
 /*!
   \property Esri::ArcGISRuntime::Toolkit::CoordinateConversionController::inPickingMode
   \brief Flag stating whether this controller is listening for input events on
@@ -509,6 +1351,19 @@ void CoordinateConversionController::setInPickingMode(bool mode)
   \sa Esri::ArcGISRuntime::Toolkit::CoordinateConversionController::inPickingMode()
  */
 
+/*!
+  \property Esri::ArcGISRuntime::Toolkit::CoordinateConversionController::inHoverMode
+  \brief Flag stating whether the current point follows the mouse cursor
+         over the geoView.
+  \sa Esri::ArcGISRuntime::Toolkit::CoordinateConversionController::inHoverMode()
+ */
+
+/*!
+  \property Esri::ArcGISRuntime::Toolkit::CoordinateConversionController::hoverUpdateInterval
+  \brief Minimum time in milliseconds between two lookups in hover mode.
+  \sa Esri::ArcGISRuntime::Toolkit::CoordinateConversionController::hoverUpdateInterval()
+ */
+
 } // Toolkit
 } // ArcGISRuntime
 } // Esri
@@ -18,20 +18,36 @@
 
 // Toolkit headers
 #include "CoordinateConversionOption.h"
+#include "Internal/GadgetListModel.h"
 #include "Internal/GenericListModel.h"
+#include "Internal/TrackedPointsModel.h"
 
 // Qt headers
+#include <QFuture>
+#include <QFutureWatcher>
+#include <QHash>
+#include <QList>
 #include <QObject>
+#include <QPointer>
 #include <QString>
+#include <QStringList>
 #include <QPointF>
+#include <QRectF>
+#include <QVector>
 
 // Qt forward declarations
+class QAbstractItemModel;
 class QAbstractListModel;
+class QEvent;
+class QTimer;
 
 // ArcGISRuntime headers
 #include <Point.h>
 #include <TaskWatcher.h>
 
+// std headers
+#include <memory>
+
 namespace Esri
 {
 namespace ArcGISRuntime
@@ -42,6 +58,9 @@ class GeoView;
 namespace Toolkit
 {
 
+class CoordinateConversionResult;
+class NotationCache;
+
 class CoordinateConversionController : public QObject
 {
   Q_OBJECT
@@ -49,7 +68,11 @@ class CoordinateConversionController : public QObject
   Q_PROPERTY(double zoomToDistance READ zoomToDistance WRITE setZoomToDistance NOTIFY zoomToDistanceChanged)
   Q_PROPERTY(QAbstractListModel* formats READ coordinateFormats CONSTANT)
   Q_PROPERTY(QAbstractListModel* results READ conversionResults CONSTANT)
+  Q_PROPERTY(QAbstractListModel* batchResults READ batchResults CONSTANT)
+  Q_PROPERTY(QAbstractItemModel* trackedPoints READ trackedPoints CONSTANT)
   Q_PROPERTY(bool inPickingMode READ inPickingMode WRITE setInPickingMode NOTIFY inPickingModeChanged)
+  Q_PROPERTY(bool inHoverMode READ inHoverMode WRITE setInHoverMode NOTIFY inHoverModeChanged)
+  Q_PROPERTY(int hoverUpdateInterval READ hoverUpdateInterval WRITE setHoverUpdateInterval NOTIFY hoverUpdateIntervalChanged)
 public:
 
   Q_INVOKABLE CoordinateConversionController(QObject* parent = nullptr);
@@ -65,10 +88,20 @@ public:
 
   GenericListModel* conversionResults() const;
 
+  GadgetListModel* batchResults() const;
+
+  TrackedPointsModel* trackedPoints() const;
+
+  void updateTrackedPoints(const QHash<qint64, Point>& points);
+
+  void removeTrackedPoints(const QList<qint64>& ids);
+
   Q_INVOKABLE Esri::ArcGISRuntime::Point currentPoint() const;
 
   Q_INVOKABLE QPointF screenCoordinate() const;
 
+  Q_INVOKABLE bool isCurrentPointOnScreen() const;
+
   double zoomToDistance() const;
 
   void setZoomToDistance(double distance);
@@ -77,15 +110,41 @@ public:
 
   void setInPickingMode(bool mode);
 
+  bool inHoverMode() const;
+
+  void setInHoverMode(bool mode);
+
+  int hoverUpdateInterval() const;
+
+  void setHoverUpdateInterval(int interval);
+
+  QList<CoordinateConversionOption*> formatsMatching(const QString& text) const;
+
+  Point pointFromText(const QString& text, const SpatialReference& spatialReference);
+
+  QFuture<QVector<QStringList>> convertBatch(const QList<Point>& points,
+                                             const QList<CoordinateConversionOption*>& options);
+
+  QFuture<QVector<QStringList>> convertBatchToResults(const QList<Point>& points,
+                                                      const QList<CoordinateConversionOption*>& options);
+
+  bool eventFilter(QObject* watched, QEvent* event) override;
+
 signals:
   void geoViewChanged();
 
   void currentPointChanged(const Esri::ArcGISRuntime::Point& point);
 
+  void screenCoordinateChanged();
+
   void zoomToDistanceChanged();
 
   void inPickingModeChanged();
 
+  void inHoverModeChanged();
+
+  void hoverUpdateIntervalChanged();
+
 public slots:
 
   void setCurrentPoint(const Esri::ArcGISRuntime::Point& point);
@@ -102,14 +161,69 @@ public slots:
 
   void removeCoordinateResultAtIndex(int index);
 
+  void clearTrackedPoints();
+
+private:
+  void refreshResults();
+
+  void startRefresh();
+
+  void refreshFinished();
+
+  void syncTrackedFormats();
+
+  void invalidateFormatsByMode();
+
+  void refreshTrackedPoints();
+
+  void queueHoverPosition(const QPointF& position);
+
+  void updateHoverPoint();
+
+  void invalidateScreenCoordinate();
+
+  void updateScreenCoordinate() const;
+
+  QRectF screenBounds() const;
+
 private:
+  struct RefreshTarget
+  {
+    QPointer<CoordinateConversionResult> result;
+    QPointer<CoordinateConversionOption> option;
+  };
+
   Point m_currentPoint;
   TaskWatcher m_screenToLocationTask;
   double m_zoomToDistance = 0.0;
   GenericListModel* m_coordinateFormats = nullptr;
+  mutable QHash<int, QList<QPointer<CoordinateConversionOption>>> m_formatsByMode;
+  mutable bool m_formatsByModeDirty = true;
   GenericListModel* m_conversionResults = nullptr;
+  GadgetListModel* m_batchResults = nullptr;
+  quint64 m_batchGeneration = 0;
   QObject* m_geoView = nullptr;
   bool m_inPickingMode = false;
+  bool m_inHoverMode = false;
+  QTimer* m_hoverTimer = nullptr;
+  QPointF m_hoverPosition;
+  bool m_hoverPending = false;
+  TaskWatcher m_hoverTask;
+  mutable QPointF m_screenCoordinate;
+  mutable bool m_screenCoordinateDirty = true;
+  mutable bool m_hasScreenCoordinate = false;
+  mutable bool m_screenCoordinateHidden = false;
+  QPointF m_notifiedScreenCoordinate;
+  bool m_notifiedOnScreen = false;
+  bool m_hasNotifiedScreenCoordinate = false;
+  QFutureWatcher<QVector<QStringList>>* m_refreshWatcher = nullptr;
+  std::shared_ptr<NotationCache> m_notationCache;
+  QList<RefreshTarget> m_refreshTargets;
+  quint64 m_refreshGeneration = 0;
+  quint64 m_runningGeneration = 0;
+  bool m_refreshing = false;
+  TrackedPointsModel* m_trackedPoints = nullptr;
+  bool m_trackedRefreshing = false;
 };
 
 } // Toolkit
@@ -15,8 +15,11 @@
  ******************************************************************************/
 #include "CoordinateConversionOption.h"
 
+// Toolkit headers
+#include "CoordinateFormatSpec.h"
+#include "Internal/NotationCache.h"
+
 // ArcGISRuntime headers
-#include <CoordinateFormatter.h>
 #include <Point.h>
 
 namespace Esri
@@ -35,6 +38,10 @@ namespace Toolkit
   
   A \c CoordinateConversionOption is able to convert between Point and QString
   using the formatting options it is currently set with.
+
+  Converted notations are kept in a bounded least-recently-used cache, so
+  formatting the same point again does not go back to the
+  \c CoordinateFormatter. Changing a formatting property clears the cache.
  */
 
 /*!
@@ -44,7 +51,8 @@ namespace Toolkit
   \endlist
  */
 CoordinateConversionOption::CoordinateConversionOption(QObject* parent):
-  QObject(parent)
+  QObject(parent),
+  m_notationCache(std::make_shared<NotationCache>())
 {
 }
 
@@ -55,6 +63,30 @@ CoordinateConversionOption::~CoordinateConversionOption()
 {
 }
 
+/*!
+  \brief Returns a new option with the same properties as this one, owned by
+  \a parent.
+
+  The clone shares this option's notation cache. Because cached notations are
+  keyed on the formatting properties, the two options may be configured
+  independently afterwards.
+ */
+CoordinateConversionOption* CoordinateConversionOption::clone(QObject* parent) const
+{
+  auto copy = new CoordinateConversionOption(parent);
+  copy->m_name = m_name;
+  copy->m_outputMode = m_outputMode;
+  copy->m_hasSpaces = m_hasSpaces;
+  copy->m_precision = m_precision;
+  copy->m_decimalPlaces = m_decimalPlaces;
+  copy->m_mgrsConversionMode = m_mgrsConversionMode;
+  copy->m_latLonFormat = m_latLonFormat;
+  copy->m_utmConversionMode = m_utmConversionMode;
+  copy->m_garsConvesrionMode = m_garsConvesrionMode;
+  copy->m_notationCache = m_notationCache;
+  return copy;
+}
+
 /*!
   \brief Returns the conversion type of this option.
  */
@@ -72,6 +104,7 @@ void CoordinateConversionOption::setOutputMode(CoordinateType outputMode)
     return;
 
   m_outputMode = outputMode;
+  invalidateNotations();
   emit outputModeChanged();
 }
 
@@ -112,6 +145,7 @@ void CoordinateConversionOption::setHasSpaces(bool hasSpaces)
     return;
 
   m_hasSpaces = hasSpaces;
+  invalidateNotations();
   emit hasSpacesChanged();
 }
 
@@ -132,6 +166,7 @@ void CoordinateConversionOption::setPrecision(int precision)
     return;
 
   m_precision = precision;
+  invalidateNotations();
   emit precisionChanged();
 }
 
@@ -152,6 +187,7 @@ void CoordinateConversionOption::setDecimalPlaces(int decimalPlaces)
     return;
 
   m_decimalPlaces = decimalPlaces;
+  invalidateNotations();
   emit decimalPlacesChanged();
 }
 
@@ -172,6 +208,7 @@ void CoordinateConversionOption::setMgrsConversionMode(MgrsConversionMode mgrsCo
     return;
 
   m_mgrsConversionMode = mgrsConversionMode;
+  invalidateNotations();
   emit mgrsConversionModeChanged();
 }
 
@@ -192,6 +229,7 @@ void CoordinateConversionOption::setLatLonFormat(LatitudeLongitudeFormat latLonF
     return;
 
   m_latLonFormat = latLonFormat;
+  invalidateNotations();
   emit latLonFormatChanged();
 }
 
@@ -212,6 +250,7 @@ void CoordinateConversionOption::setUtmConversionMode(UtmConversionMode utmConve
     return;
 
   m_utmConversionMode = utmConversionMode;
+  invalidateNotations();
   emit utmConversionModeChanged();
 }
 
@@ -235,6 +274,45 @@ void CoordinateConversionOption::setGarsConversionMode(GarsConversionMode conver
   emit garsConversionModeChanged();
 }
 
+/*!
+  \brief Returns the formatting properties of this option as a
+  \c CoordinateFormatSpec.
+
+  The spec is a plain value that can be copied to other threads and used
+  with \c formatCoordinate, \c formatCoordinates and \c parseCoordinate
+  without touching this option.
+ */
+CoordinateFormatSpec CoordinateConversionOption::spec() const
+{
+  return CoordinateFormatSpec()
+      .withOutputMode(m_outputMode)
+      .withSpaces(m_hasSpaces)
+      .withPrecision(m_precision)
+      .withDecimalPlaces(m_decimalPlaces)
+      .withMgrsConversionMode(m_mgrsConversionMode)
+      .withLatLonFormat(m_latLonFormat)
+      .withUtmConversionMode(m_utmConversionMode)
+      .withGarsConversionMode(m_garsConvesrionMode);
+}
+
+/*!
+  \brief Sets every formatting property of this option to those of \a spec.
+
+  The name of this option is left unchanged. A change signal is emitted for
+  each property that differs.
+ */
+void CoordinateConversionOption::setSpec(const CoordinateFormatSpec& spec)
+{
+  setOutputMode(spec.outputMode());
+  setHasSpaces(spec.hasSpaces());
+  setPrecision(spec.precision());
+  setDecimalPlaces(spec.decimalPlaces());
+  setMgrsConversionMode(spec.mgrsConversionMode());
+  setLatLonFormat(spec.latLonFormat());
+  setUtmConversionMode(spec.utmConversionMode());
+  setGarsConversionMode(spec.garsConversionMode());
+}
+
 /*!
   \brief Converts a \c Point to a \c QString based on the properties set in this
   \c CoordinateConversionOption.
@@ -248,38 +326,73 @@ void CoordinateConversionOption::setGarsConversionMode(GarsConversionMode conver
  */
 QString CoordinateConversionOption::prettyPrint(const Point& point) const
 {
-  switch (outputMode())
-  {
-    case CoordinateType::Gars:
-    {
-      return CoordinateFormatter::toGars(point);
-    }
-    case CoordinateType::GeoRef:
-    {
-      return CoordinateFormatter::toGeoRef(point, precision());
-    }
-    case CoordinateType::LatLon:
-    {
-      const auto format = latLonFormat();
-      return CoordinateFormatter::toLatitudeLongitude(point, format, decimalPlaces());
-    }
-    case CoordinateType::Mgrs:
-    {
-      const auto conversionMode = mgrsConversionMode();
-      return CoordinateFormatter::toMgrs(point, conversionMode, decimalPlaces(), hasSpaces());
-    }
-    case CoordinateType::Usng:
-    {
-      return CoordinateFormatter::toUsng(point, precision(), decimalPlaces());
-    }
-    case CoordinateType::Utm:
-    {
-      const auto conversionMode = utmConversionMode();
-      return CoordinateFormatter::toUtm(point, conversionMode, hasSpaces());
-    }
-    default: 
-      return QString();
-  }
+  return formatCoordinate(spec(), point, *m_notationCache);
+}
+
+/*!
+  \brief Converts every point in \a points to a \c QString based on the
+  properties set in this \c CoordinateConversionOption.
+
+  Several points are converted together, as \c formatCoordinates does,
+  without going through the notation cache. A single point is converted as
+  \l prettyPrint does.
+
+  \list
+  \li \a points Points to convert.
+  \endlist
+
+  Returns one notation per point, in the order of \a points.
+ */
+QStringList CoordinateConversionOption::prettyPrint(const QList<Point>& points) const
+{
+  return formatCoordinates(spec(), points, *m_notationCache);
+}
+
+/*!
+  \brief Returns the maximum number of notations cached by this option.
+  Defaults to 256.
+ */
+int CoordinateConversionOption::notationCacheCapacity() const
+{
+  return m_notationCache->capacity();
+}
+
+/*!
+  \brief Sets the maximum number of notations cached by this option to
+  \a capacity. A capacity of \c 0 disables caching.
+
+  The capacity is shared with clones of this option.
+ */
+void CoordinateConversionOption::setNotationCacheCapacity(int capacity)
+{
+  m_notationCache->setCapacity(capacity);
+}
+
+/*!
+  \brief Returns the number of times \l prettyPrint was served from the
+  notation cache.
+ */
+quint64 CoordinateConversionOption::notationCacheHits() const
+{
+  return m_notationCache->hits();
+}
+
+/*!
+  \brief Returns the number of times \l prettyPrint had to convert a point
+  because it was not in the notation cache.
+ */
+quint64 CoordinateConversionOption::notationCacheMisses() const
+{
+  return m_notationCache->misses();
+}
+
+/*!
+  \internal
+  \brief Discards cached notations after a formatting property changed.
+ */
+void CoordinateConversionOption::invalidateNotations()
+{
+  m_notationCache->clear();
 }
 
 /*!
@@ -298,46 +411,7 @@ QString CoordinateConversionOption::prettyPrint(const Point& point) const
  */
 Point CoordinateConversionOption::pointFromString(const QString& point, const SpatialReference& spatialReference)
 {
-  if (spatialReference.isEmpty())
-      qWarning("The spatial reference property is empty: conversions will fail.");
-
-  switch (outputMode())
-  {
-  case CoordinateType::Gars:
-  {
-    return CoordinateFormatter::fromGars(point,
-                                         spatialReference,
-                                         garsConversionMode());
-  }
-  case CoordinateType::GeoRef:
-  {
-    return CoordinateFormatter::fromGeoRef(point,
-                                           spatialReference);
-  }
-  case CoordinateType::LatLon:
-  {
-    return CoordinateFormatter::fromLatitudeLongitude(point,
-                                                      spatialReference);
-  }
-  case CoordinateType::Mgrs:
-  {
-    return CoordinateFormatter::fromMgrs(point,
-                                         spatialReference,
-                                         mgrsConversionMode());
-  }
-  case CoordinateType::Usng:
-  {
-    return CoordinateFormatter::fromUsng(point,
-                                         spatialReference);
-  }
-  case CoordinateType::Utm:
-  {
-    return CoordinateFormatter::fromUtm(point,
-                                        spatialReference,
-                                        utmConversionMode());
-  }
-  default: return Point();
-  }
+  return parseCoordinate(spec(), point, spatialReference);
 }
 
 /*!
@@ -17,13 +17,18 @@
 #define ESRI_ARCGISRUNTIME_TOOLKIT_COORDINATECONVERSIONOPTION_H
 
 // Qt headers
+#include <QList>
 #include <QObject>
+#include <QStringList>
 
 // ArcGISRuntime headers
 #include <GeometryTypes.h>
 #include <Point.h>
 #include <SpatialReference.h>
 
+// std headers
+#include <memory>
+
 namespace Esri
 {
 namespace ArcGISRuntime
@@ -32,6 +37,9 @@ namespace ArcGISRuntime
 namespace Toolkit
 {
 
+class CoordinateFormatSpec;
+class NotationCache;
+
 class CoordinateConversionOption : public QObject
 {
   Q_OBJECT
@@ -63,8 +71,16 @@ public:
 
   ~CoordinateConversionOption() override;
 
+  CoordinateConversionOption* clone(QObject* parent = nullptr) const;
+
+  CoordinateFormatSpec spec() const;
+
+  void setSpec(const CoordinateFormatSpec& spec);
+
   QString prettyPrint(const Point& point) const;
 
+  QStringList prettyPrint(const QList<Point>& points) const;
+
   Point pointFromString(const QString& point,
                         const SpatialReference& spatialReference);
 
@@ -104,6 +120,14 @@ public:
 
   void setGarsConversionMode(GarsConversionMode conversionMode);
 
+  int notationCacheCapacity() const;
+
+  void setNotationCacheCapacity(int capacity);
+
+  quint64 notationCacheHits() const;
+
+  quint64 notationCacheMisses() const;
+
 signals:
   void nameChanged();
 
@@ -123,6 +147,9 @@ signals:
 
   void garsConversionModeChanged();
 
+private:
+  void invalidateNotations();
+
 private:
   QString m_name;
   CoordinateType m_outputMode = CoordinateType::Usng;
@@ -133,6 +160,7 @@ private:
   LatitudeLongitudeFormat m_latLonFormat = LatitudeLongitudeFormat::DecimalDegrees;
   UtmConversionMode m_utmConversionMode = UtmConversionMode::LatitudeBandIndicators;
   GarsConversionMode m_garsConvesrionMode = GarsConversionMode::Center;
+  std::shared_ptr<NotationCache> m_notationCache;
 };
 
 } // Toolkit
@@ -138,15 +138,15 @@ void CoordinateConversionResult::setNotation(const QString& notation)
   \brief Given a \a point, updates the notation of this object to the textual
   representation of the point as dictated by the formatting options given
   in type.
+
+  \c notationChanged is only emitted if the notation differs.
  */
 void CoordinateConversionResult::updateCoordinatePoint(const Point& point)
 {
-  if(!m_type)
-    m_notation = "";
+  if (!m_type)
+    setNotation("");
   else
-    m_notation = m_type->prettyPrint(point);
-
-  emit notationChanged();
+    setNotation(m_type->prettyPrint(point));
 }
 
 /*!
@@ -0,0 +1,378 @@
+/*******************************************************************************
+ *  Copyright 2012-2020 Esri
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+#include "CoordinateFormatSpec.h"
+
+// Toolkit headers
+#include "Internal/GridReferenceFormatter.h"
+#include "Internal/LatitudeLongitudeFormatter.h"
+#include "Internal/NotationCache.h"
+
+// ArcGISRuntime headers
+#include <CoordinateFormatter.h>
+#include <SpatialReference.h>
+
+// std headers
+#include <cmath>
+#include <vector>
+
+namespace Esri
+{
+namespace ArcGISRuntime
+{
+namespace Toolkit
+{
+
+namespace
+{
+
+using CoordinateType = CoordinateFormatSpec::CoordinateType;
+
+// The toolkit's own formatters are opt-in until they are checked against the
+// CoordinateFormatter of the ArcGIS Runtime in use by tst_coordinateconversion.
+#ifdef NATIVE_FORMATTERS_ARCGISRUNTIME_TOOLKIT
+constexpr bool NATIVE_FORMATTERS = true;
+#else
+constexpr bool NATIVE_FORMATTERS = false;
+#endif
+
+// Returns the wkid of WGS84. SpatialReference::wgs84 builds a new spatial
+// reference on every call, so it is looked up once.
+int wgs84Wkid()
+{
+  static const int wkid = SpatialReference::wgs84().wkid();
+  return wkid;
+}
+
+// Returns whether \a point is a point in WGS84 which \a Formatter can handle
+// without projecting. \a wgs84 is the wkid of WGS84.
+template <typename Formatter>
+bool canFormat(const Point& point, int wgs84)
+{
+  if (point.isEmpty() || point.spatialReference().wkid() != wgs84)
+    return false;
+
+  return Formatter::canFormat(point.y(), point.x());
+}
+
+// Returns the grid reference formatter matching the UTM, MGRS or USNG
+// output of \a spec. The parameters mirror those passed to the
+// CoordinateFormatter in formatCoordinate.
+GridReferenceFormatter gridFormatter(const CoordinateFormatSpec& spec)
+{
+  switch (spec.outputMode())
+  {
+    case CoordinateType::Mgrs:
+      return GridReferenceFormatter::mgrs(spec.mgrsConversionMode(), spec.decimalPlaces(), spec.hasSpaces());
+    case CoordinateType::Usng:
+      return GridReferenceFormatter::usng(spec.precision(), spec.decimalPlaces() != 0);
+    default:
+      return GridReferenceFormatter::utm(spec.utmConversionMode(), spec.hasSpaces());
+  }
+}
+
+// Builds the cache key of \a point in the notation described by \a spec.
+// Returns false for points without a well-known spatial reference, or
+// without finite coordinates, as those cannot be keyed reliably.
+bool notationKey(const CoordinateFormatSpec& spec, const Point& point, NotationCache::Key& key)
+{
+  const int wkid = point.isEmpty() ? 0 : point.spatialReference().wkid();
+  if (wkid <= 0 || !std::isfinite(point.x()) || !std::isfinite(point.y()))
+    return false;
+
+  key.x = point.x();
+  key.y = point.y();
+  key.wkid = wkid;
+  key.outputMode = static_cast<int>(spec.outputMode());
+  key.precision = spec.precision();
+  key.decimalPlaces = spec.decimalPlaces();
+  key.mgrsConversionMode = static_cast<int>(spec.mgrsConversionMode());
+  key.latLonFormat = static_cast<int>(spec.latLonFormat());
+  key.utmConversionMode = static_cast<int>(spec.utmConversionMode());
+  key.hasSpaces = spec.hasSpaces();
+  return true;
+}
+
+// Formats all points \a formatter can handle in one pass, and the rest one
+// at a time with formatCoordinate. Unsupported points are formatted at the
+// origin, then replaced.
+template <typename Formatter>
+QStringList formatBatch(const Formatter& formatter, const QList<Point>& points,
+                        const CoordinateFormatSpec& spec)
+{
+  const int count = points.size();
+  std::vector<double> latitudes(count, 0.0);
+  std::vector<double> longitudes(count, 0.0);
+  std::vector<bool> supported(count, false);
+  const int wgs84 = wgs84Wkid();
+  for (int i = 0; i < count; ++i)
+  {
+    const auto& point = points.at(i);
+    if (canFormat<Formatter>(point, wgs84))
+    {
+      latitudes[i] = point.y();
+      longitudes[i] = point.x();
+      supported[i] = true;
+    }
+  }
+
+  std::vector<QString> formatted(count);
+  formatter.format(latitudes.data(), longitudes.data(), count, formatted.data());
+
+  QStringList notations;
+  notations.reserve(count);
+  for (int i = 0; i < count; ++i)
+    notations.append(supported[i] ? formatted[i] : formatCoordinate(spec, points.at(i)));
+
+  return notations;
+}
+
+}
+
+/*!
+  \class Esri::ArcGISRuntime::Toolkit::CoordinateFormatSpec
+  \inmodule ArcGISRuntimeToolkit
+  \ingroup ArcGISQtToolkitUiCppControllers
+  \brief A \c CoordinateFormatSpec holds the formatting properties of a
+  \c CoordinateConversionOption as a plain value.
+
+  Unlike a \c CoordinateConversionOption, a spec has no thread affinity,
+  signals or cache, and is trivially copyable. A spec can be taken from an
+  option with \c CoordinateConversionOption::spec and handed to any number
+  of worker threads, which convert with \l formatCoordinate,
+  \l formatCoordinates and \l parseCoordinate without locks.
+
+  Specs are immutable. Each \c with function returns a copy with one
+  property changed, and all of them are \c constexpr, so presets such as
+  those in \c CoordinateOptionDefaults can be built at compile time.
+
+  The defaults match those of a new \c CoordinateConversionOption.
+
+  \sa Esri::ArcGISRuntime::Toolkit::CoordinateConversionOption
+ */
+
+/*!
+  \fn QString Esri::ArcGISRuntime::Toolkit::formatCoordinate(const CoordinateFormatSpec& spec, const Point& point)
+  \relates Esri::ArcGISRuntime::Toolkit::CoordinateFormatSpec
+  \brief Returns \a point in the notation described by \a spec.
+
+  If the toolkit is built with \c NATIVE_FORMATTERS_ARCGISRUNTIME_TOOLKIT
+  defined, latitude and longitude, UTM, MGRS and USNG notations of WGS84
+  points are formatted by the toolkit. Otherwise, and for all other points,
+  the \c CoordinateFormatter is used. This function is thread-safe.
+ */
+QString formatCoordinate(const CoordinateFormatSpec& spec, const Point& point)
+{
+  switch (spec.outputMode())
+  {
+    case CoordinateType::Gars:
+    {
+      return CoordinateFormatter::toGars(point);
+    }
+    case CoordinateType::GeoRef:
+    {
+      return CoordinateFormatter::toGeoRef(point, spec.precision());
+    }
+    case CoordinateType::LatLon:
+    {
+      const auto format = spec.latLonFormat();
+      const LatitudeLongitudeFormatter formatter(format, spec.decimalPlaces());
+      if (NATIVE_FORMATTERS && formatter.isSupported() &&
+          canFormat<LatitudeLongitudeFormatter>(point, wgs84Wkid()))
+        return formatter.format(point.y(), point.x());
+
+      return CoordinateFormatter::toLatitudeLongitude(point, format, spec.decimalPlaces());
+    }
+    case CoordinateType::Mgrs:
+    {
+      const auto formatter = gridFormatter(spec);
+      if (NATIVE_FORMATTERS && formatter.isSupported() &&
+          canFormat<GridReferenceFormatter>(point, wgs84Wkid()))
+        return formatter.format(point.y(), point.x());
+
+      return CoordinateFormatter::toMgrs(point, spec.mgrsConversionMode(), spec.decimalPlaces(), spec.hasSpaces());
+    }
+    case CoordinateType::Usng:
+    {
+      const auto formatter = gridFormatter(spec);
+      if (NATIVE_FORMATTERS && formatter.isSupported() &&
+          canFormat<GridReferenceFormatter>(point, wgs84Wkid()))
+        return formatter.format(point.y(), point.x());
+
+      return CoordinateFormatter::toUsng(point, spec.precision(), spec.decimalPlaces());
+    }
+    case CoordinateType::Utm:
+    {
+      const auto formatter = gridFormatter(spec);
+      if (NATIVE_FORMATTERS && formatter.isSupported() &&
+          canFormat<GridReferenceFormatter>(point, wgs84Wkid()))
+        return formatter.format(point.y(), point.x());
+
+      return CoordinateFormatter::toUtm(point, spec.utmConversionMode(), spec.hasSpaces());
+    }
+    default:
+      return QString();
+  }
+}
+
+/*!
+  \fn QStringList Esri::ArcGISRuntime::Toolkit::formatCoordinates(const CoordinateFormatSpec& spec, const QList<Point>& points)
+  \relates Esri::ArcGISRuntime::Toolkit::CoordinateFormatSpec
+  \brief Returns every point in \a points in the notation described by
+  \a spec, in the order of \a points.
+
+  If the toolkit is built with \c NATIVE_FORMATTERS_ARCGISRUNTIME_TOOLKIT
+  defined, latitude and longitude, UTM, MGRS and USNG notations of WGS84
+  points are formatted by the toolkit in one pass. All other points are
+  converted one at a time with \l formatCoordinate. This function is
+  thread-safe.
+ */
+QStringList formatCoordinates(const CoordinateFormatSpec& spec, const QList<Point>& points)
+{
+  switch (spec.outputMode())
+  {
+    case CoordinateType::LatLon:
+    {
+      const LatitudeLongitudeFormatter formatter(spec.latLonFormat(), spec.decimalPlaces());
+      if (NATIVE_FORMATTERS && formatter.isSupported())
+        return formatBatch(formatter, points, spec);
+
+      break;
+    }
+    case CoordinateType::Mgrs:
+    case CoordinateType::Usng:
+    case CoordinateType::Utm:
+    {
+      const auto formatter = gridFormatter(spec);
+      if (NATIVE_FORMATTERS && formatter.isSupported())
+        return formatBatch(formatter, points, spec);
+
+      break;
+    }
+    default:
+      break;
+  }
+
+  QStringList notations;
+  notations.reserve(points.size());
+  for (const auto& point : points)
+    notations.append(formatCoordinate(spec, point));
+
+  return notations;
+}
+
+/*!
+  \fn QString Esri::ArcGISRuntime::Toolkit::formatCoordinate(const CoordinateFormatSpec& spec, const Point& point, NotationCache& cache)
+  \relates Esri::ArcGISRuntime::Toolkit::CoordinateFormatSpec
+  \internal
+  \brief Returns \a point in the notation described by \a spec, looking it
+  up in \a cache first and caching it on a miss.
+
+  The cache is keyed on the spec, so one cache can serve any number of specs.
+  This function is thread-safe.
+ */
+QString formatCoordinate(const CoordinateFormatSpec& spec, const Point& point, NotationCache& cache)
+{
+  NotationCache::Key key;
+  if (!notationKey(spec, point, key))
+    return formatCoordinate(spec, point);
+
+  QString notation;
+  if (cache.lookup(key, notation))
+    return notation;
+
+  notation = formatCoordinate(spec, point);
+  cache.insert(key, notation);
+  return notation;
+}
+
+/*!
+  \fn QStringList Esri::ArcGISRuntime::Toolkit::formatCoordinates(const CoordinateFormatSpec& spec, const QList<Point>& points, NotationCache& cache)
+  \relates Esri::ArcGISRuntime::Toolkit::CoordinateFormatSpec
+  \internal
+  \brief Returns every point in \a points in the notation described by
+  \a spec, in the order of \a points.
+
+  Only a single point goes through \a cache. Several points are formatted as
+  \l formatCoordinates does, since they rarely repeat, and a lookup per point
+  would evict the cache and contend for its lock across worker threads.
+  This function is thread-safe.
+ */
+QStringList formatCoordinates(const CoordinateFormatSpec& spec, const QList<Point>& points,
+                              NotationCache& cache)
+{
+  if (points.size() != 1)
+    return formatCoordinates(spec, points);
+
+  return QStringList { formatCoordinate(spec, points.first(), cache) };
+}
+
+/*!
+  \fn Point Esri::ArcGISRuntime::Toolkit::parseCoordinate(const CoordinateFormatSpec& spec, const QString& text, const SpatialReference& spatialReference)
+  \relates Esri::ArcGISRuntime::Toolkit::CoordinateFormatSpec
+  \brief Returns \a text, in the notation described by \a spec, as a point
+  in \a spatialReference.
+
+  If \a text cannot be parsed an invalid default-constructed \c Point is
+  returned. This function is thread-safe.
+ */
+Point parseCoordinate(const CoordinateFormatSpec& spec, const QString& text,
+                      const SpatialReference& spatialReference)
+{
+  if (spatialReference.isEmpty())
+      qWarning("The spatial reference property is empty: conversions will fail.");
+
+  switch (spec.outputMode())
+  {
+  case CoordinateType::Gars:
+  {
+    return CoordinateFormatter::fromGars(text,
+                                         spatialReference,
+                                         spec.garsConversionMode());
+  }
+  case CoordinateType::GeoRef:
+  {
+    return CoordinateFormatter::fromGeoRef(text,
+                                           spatialReference);
+  }
+  case CoordinateType::LatLon:
+  {
+    return CoordinateFormatter::fromLatitudeLongitude(text,
+                                                      spatialReference);
+  }
+  case CoordinateType::Mgrs:
+  {
+    return CoordinateFormatter::fromMgrs(text,
+                                         spatialReference,
+                                         spec.mgrsConversionMode());
+  }
+  case CoordinateType::Usng:
+  {
+    return CoordinateFormatter::fromUsng(text,
+                                         spatialReference);
+  }
+  case CoordinateType::Utm:
+  {
+    return CoordinateFormatter::fromUtm(text,
+                                        spatialReference,
+                                        spec.utmConversionMode());
+  }
+  default: return Point();
+  }
+}
+
+} // Toolkit
+} // ArcGISRuntime
+} // Esri
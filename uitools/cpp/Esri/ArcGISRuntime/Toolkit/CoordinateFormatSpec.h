@@ -0,0 +1,171 @@
+/*******************************************************************************
+ *  Copyright 2012-2020 Esri
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+#ifndef ESRI_ARCGISRUNTIME_TOOLKIT_COORDINATEFORMATSPEC_H
+#define ESRI_ARCGISRUNTIME_TOOLKIT_COORDINATEFORMATSPEC_H
+
+// Toolkit headers
+#include "CoordinateConversionOption.h"
+
+// Qt headers
+#include <QList>
+#include <QString>
+#include <QStringList>
+
+// ArcGISRuntime headers
+#include <GeometryTypes.h>
+#include <Point.h>
+#include <SpatialReference.h>
+
+// std headers
+#include <type_traits>
+
+namespace Esri
+{
+namespace ArcGISRuntime
+{
+namespace Toolkit
+{
+
+class NotationCache;
+
+class CoordinateFormatSpec
+{
+public:
+  using CoordinateType = CoordinateConversionOption::CoordinateType;
+
+  constexpr CoordinateFormatSpec() = default;
+
+  constexpr CoordinateType outputMode() const { return m_outputMode; }
+
+  constexpr bool hasSpaces() const { return m_hasSpaces; }
+
+  constexpr int precision() const { return m_precision; }
+
+  constexpr int decimalPlaces() const { return m_decimalPlaces; }
+
+  constexpr MgrsConversionMode mgrsConversionMode() const { return m_mgrsConversionMode; }
+
+  constexpr LatitudeLongitudeFormat latLonFormat() const { return m_latLonFormat; }
+
+  constexpr UtmConversionMode utmConversionMode() const { return m_utmConversionMode; }
+
+  constexpr GarsConversionMode garsConversionMode() const { return m_garsConversionMode; }
+
+  constexpr CoordinateFormatSpec withOutputMode(CoordinateType outputMode) const
+  {
+    auto spec = *this;
+    spec.m_outputMode = outputMode;
+    return spec;
+  }
+
+  constexpr CoordinateFormatSpec withSpaces(bool hasSpaces) const
+  {
+    auto spec = *this;
+    spec.m_hasSpaces = hasSpaces;
+    return spec;
+  }
+
+  constexpr CoordinateFormatSpec withPrecision(int precision) const
+  {
+    auto spec = *this;
+    spec.m_precision = precision;
+    return spec;
+  }
+
+  constexpr CoordinateFormatSpec withDecimalPlaces(int decimalPlaces) const
+  {
+    auto spec = *this;
+    spec.m_decimalPlaces = decimalPlaces;
+    return spec;
+  }
+
+  constexpr CoordinateFormatSpec withMgrsConversionMode(MgrsConversionMode mode) const
+  {
+    auto spec = *this;
+    spec.m_mgrsConversionMode = mode;
+    return spec;
+  }
+
+  constexpr CoordinateFormatSpec withLatLonFormat(LatitudeLongitudeFormat format) const
+  {
+    auto spec = *this;
+    spec.m_latLonFormat = format;
+    return spec;
+  }
+
+  constexpr CoordinateFormatSpec withUtmConversionMode(UtmConversionMode mode) const
+  {
+    auto spec = *this;
+    spec.m_utmConversionMode = mode;
+    return spec;
+  }
+
+  constexpr CoordinateFormatSpec withGarsConversionMode(GarsConversionMode mode) const
+  {
+    auto spec = *this;
+    spec.m_garsConversionMode = mode;
+    return spec;
+  }
+
+  constexpr bool operator==(const CoordinateFormatSpec& other) const
+  {
+    return m_outputMode == other.m_outputMode &&
+           m_hasSpaces == other.m_hasSpaces &&
+           m_precision == other.m_precision &&
+           m_decimalPlaces == other.m_decimalPlaces &&
+           m_mgrsConversionMode == other.m_mgrsConversionMode &&
+           m_latLonFormat == other.m_latLonFormat &&
+           m_utmConversionMode == other.m_utmConversionMode &&
+           m_garsConversionMode == other.m_garsConversionMode;
+  }
+
+  constexpr bool operator!=(const CoordinateFormatSpec& other) const
+  {
+    return !(*this == other);
+  }
+
+private:
+  // Defaults match those of CoordinateConversionOption.
+  CoordinateType m_outputMode = CoordinateType::Usng;
+  bool m_hasSpaces = true;
+  int m_precision = 8;
+  int m_decimalPlaces = 6;
+  MgrsConversionMode m_mgrsConversionMode = MgrsConversionMode::Automatic;
+  LatitudeLongitudeFormat m_latLonFormat = LatitudeLongitudeFormat::DecimalDegrees;
+  UtmConversionMode m_utmConversionMode = UtmConversionMode::LatitudeBandIndicators;
+  GarsConversionMode m_garsConversionMode = GarsConversionMode::Center;
+};
+
+static_assert(std::is_trivially_copyable<CoordinateFormatSpec>::value,
+              "CoordinateFormatSpec must be trivially copyable");
+
+QString formatCoordinate(const CoordinateFormatSpec& spec, const Point& point);
+
+QStringList formatCoordinates(const CoordinateFormatSpec& spec, const QList<Point>& points);
+
+QString formatCoordinate(const CoordinateFormatSpec& spec, const Point& point, NotationCache& cache);
+
+QStringList formatCoordinates(const CoordinateFormatSpec& spec, const QList<Point>& points,
+                              NotationCache& cache);
+
+Point parseCoordinate(const CoordinateFormatSpec& spec, const QString& text,
+                      const SpatialReference& spatialReference);
+
+} // Toolkit
+} // ArcGISRuntime
+} // Esri
+
+#endif // ESRI_ARCGISRUNTIME_TOOLKIT_COORDINATEFORMATSPEC_H
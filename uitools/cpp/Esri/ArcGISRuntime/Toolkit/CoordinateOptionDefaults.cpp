@@ -28,8 +28,7 @@ CoordinateConversionOption* createDecimalDegrees(QObject* parent)
 {
   auto option = new CoordinateConversionOption(parent);
   option->setName(CoordinateConversionConstants::DECIMAL_DEGREES_FORMAT);
-  option->setOutputMode(CoordinateConversionOption::CoordinateType::LatLon);
-  option->setLatLonFormat(LatitudeLongitudeFormat::DecimalDegrees);
+  option->setSpec(decimalDegreesSpec());
   return option;
 }
 
@@ -37,8 +36,7 @@ CoordinateConversionOption* createDegreesDecimalMinutes(QObject* parent)
 {
   auto option = new CoordinateConversionOption(parent);
   option->setName(CoordinateConversionConstants::DEGREES_DECIMAL_MINUTES_FORMAT);
-  option->setOutputMode(CoordinateConversionOption::CoordinateType::LatLon);
-  option->setLatLonFormat(LatitudeLongitudeFormat::DegreesDecimalMinutes);
+  option->setSpec(degreesDecimalMinutesSpec());
   return option;
 }
 
@@ -46,8 +44,7 @@ CoordinateConversionOption* createDegreesMinutesSeconds(QObject* parent)
 {
   auto option = new CoordinateConversionOption(parent);
   option->setName(CoordinateConversionConstants::DEGREES_MINUTES_SECONDS_FORMAT);
-  option->setOutputMode(CoordinateConversionOption::CoordinateType::LatLon);
-  option->setLatLonFormat(LatitudeLongitudeFormat::DegreesMinutesSeconds);
+  option->setSpec(degreesMinutesSecondsSpec());
   return option;
 }
 
@@ -55,8 +52,7 @@ CoordinateConversionOption* createMgrs(MgrsConversionMode mode, QObject* parent)
 {
   auto option = new CoordinateConversionOption(parent);
   option->setName(CoordinateConversionConstants::MGRS_FORMAT);
-  option->setOutputMode(CoordinateConversionOption::CoordinateType::Mgrs);
-  option->setMgrsConversionMode(mode);
+  option->setSpec(mgrsSpec(mode));
   return option;
 }
 
@@ -64,9 +60,7 @@ CoordinateConversionOption* createUsng(int precision, bool useSpaces, QObject* p
 {
   auto option = new CoordinateConversionOption(parent);
   option->setName(CoordinateConversionConstants::USNG_FORMAT);
-  option->setOutputMode(CoordinateConversionOption::CoordinateType::Usng);
-  option->setPrecision(precision);
-  option->setHasSpaces(useSpaces);
+  option->setSpec(usngSpec(precision, useSpaces));
   return option;
 }
 
@@ -74,9 +68,7 @@ CoordinateConversionOption* createUtm(UtmConversionMode mode, bool useSpaces, QO
 {
   auto option = new CoordinateConversionOption(parent);
   option->setName(CoordinateConversionConstants::UTM_FORMAT);
-  option->setOutputMode(CoordinateConversionOption::CoordinateType::Utm);
-  option->setUtmConversionMode(mode);
-  option->setHasSpaces(useSpaces);
+  option->setSpec(utmSpec(mode, useSpaces));
   return option;
 }
 
@@ -84,8 +76,7 @@ CoordinateConversionOption* createGars(GarsConversionMode mode, QObject* parent)
 {
   auto option = new CoordinateConversionOption(parent);
   option->setName(CoordinateConversionConstants::GARS_FORMAT);
-  option->setOutputMode(CoordinateConversionOption::CoordinateType::Gars);
-  option->setGarsConversionMode(mode);
+  option->setSpec(garsSpec(mode));
   return option;
 }
 
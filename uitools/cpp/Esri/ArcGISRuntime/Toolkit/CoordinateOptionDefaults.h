@@ -17,6 +17,7 @@
 #define ESRI_ARCGISRUNTIME_TOOLKIT_COORDIANTEOPTIONDEFAULTS_H
 
 #include "CoordinateConversionOption.h"
+#include "CoordinateFormatSpec.h"
 
 namespace Esri
 {
@@ -25,6 +26,57 @@ namespace ArcGISRuntime
 namespace Toolkit
 {
 
+constexpr CoordinateFormatSpec decimalDegreesSpec()
+{
+  return CoordinateFormatSpec()
+      .withOutputMode(CoordinateConversionOption::CoordinateType::LatLon)
+      .withLatLonFormat(LatitudeLongitudeFormat::DecimalDegrees);
+}
+
+constexpr CoordinateFormatSpec degreesDecimalMinutesSpec()
+{
+  return CoordinateFormatSpec()
+      .withOutputMode(CoordinateConversionOption::CoordinateType::LatLon)
+      .withLatLonFormat(LatitudeLongitudeFormat::DegreesDecimalMinutes);
+}
+
+constexpr CoordinateFormatSpec degreesMinutesSecondsSpec()
+{
+  return CoordinateFormatSpec()
+      .withOutputMode(CoordinateConversionOption::CoordinateType::LatLon)
+      .withLatLonFormat(LatitudeLongitudeFormat::DegreesMinutesSeconds);
+}
+
+constexpr CoordinateFormatSpec mgrsSpec(MgrsConversionMode mode = MgrsConversionMode::Automatic)
+{
+  return CoordinateFormatSpec()
+      .withOutputMode(CoordinateConversionOption::CoordinateType::Mgrs)
+      .withMgrsConversionMode(mode);
+}
+
+constexpr CoordinateFormatSpec usngSpec(int precision = 7, bool useSpaces = true)
+{
+  return CoordinateFormatSpec()
+      .withOutputMode(CoordinateConversionOption::CoordinateType::Usng)
+      .withPrecision(precision)
+      .withSpaces(useSpaces);
+}
+
+constexpr CoordinateFormatSpec utmSpec(UtmConversionMode mode = UtmConversionMode::NorthSouthIndicators, bool useSpaces = true)
+{
+  return CoordinateFormatSpec()
+      .withOutputMode(CoordinateConversionOption::CoordinateType::Utm)
+      .withUtmConversionMode(mode)
+      .withSpaces(useSpaces);
+}
+
+constexpr CoordinateFormatSpec garsSpec(GarsConversionMode mode = GarsConversionMode::Center)
+{
+  return CoordinateFormatSpec()
+      .withOutputMode(CoordinateConversionOption::CoordinateType::Gars)
+      .withGarsConversionMode(mode);
+}
+
 CoordinateConversionOption* createDecimalDegrees(QObject* parent = nullptr);
 
 CoordinateConversionOption* createDegreesDecimalMinutes(QObject* parent = nullptr);
@@ -0,0 +1,48 @@
+/*******************************************************************************
+ *  Copyright 2012-2020 Esri
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+#ifndef ESRI_ARCGISRUNTIME_TOOLKIT_INTERNAL_CONVERTEDPOINT_H
+#define ESRI_ARCGISRUNTIME_TOOLKIT_INTERNAL_CONVERTEDPOINT_H
+
+// Qt headers
+#include <QMetaType>
+#include <QStringList>
+
+namespace Esri
+{
+namespace ArcGISRuntime
+{
+namespace Toolkit
+{
+
+class ConvertedPoint
+{
+  Q_GADGET
+  Q_PROPERTY(double x MEMBER x)
+  Q_PROPERTY(double y MEMBER y)
+  Q_PROPERTY(QStringList notations MEMBER notations)
+public:
+  double x = 0.0;
+  double y = 0.0;
+  QStringList notations;
+};
+
+} // Toolkit
+} // ArcGISRuntime
+} // Esri
+
+Q_DECLARE_METATYPE(Esri::ArcGISRuntime::Toolkit::ConvertedPoint)
+
+#endif // ESRI_ARCGISRUNTIME_TOOLKIT_INTERNAL_CONVERTEDPOINT_H
@@ -0,0 +1,207 @@
+/*******************************************************************************
+ *  Copyright 2012-2020 Esri
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+#include "ElementTypeInfo.h"
+
+// Qt headers
+#include <QMutex>
+#include <QMutexLocker>
+#include <QStringList>
+
+// std headers
+#include <memory>
+#include <unordered_map>
+
+namespace Esri
+{
+namespace ArcGISRuntime
+{
+namespace Toolkit
+{
+
+namespace
+{
+
+/*
+  \internal
+  \brief Takes a string and transforms it into title-case.
+
+  This is for property headers.
+
+  \list
+  \li \a string String to turn into title case.
+  \endlist
+
+  Returns a title-case string.
+ */
+QString toTitleCase(const QString& string)
+{
+  QStringList parts = string.split(' ', Qt::SkipEmptyParts);
+  for (auto& part: parts)
+  {
+    part.replace(0, 1, part.at(0).toUpper());
+  }
+  return parts.join(" ");
+}
+
+}
+
+/*!
+  \internal
+
+  \inmodule EsriArcGISRuntimeToolkit
+  \class Esri::ArcGISRuntime::Toolkit::ElementTypeInfo
+
+  \brief An immutable table of the property metadata that GenericListModel and
+  GenericTableProxyModel need for a given element type.
+
+  Looking up a \c QMetaProperty by index is not free, and neither is building
+  role names or header titles. An \c ElementTypeInfo performs this work once
+  per \c QMetaObject, and the result is shared by every model that uses the
+  same element type.
+
+  Properties are indexed relative to the \c QMetaObject property offset, so
+  index \c 0 is the first property declared on the element type itself and
+  maps to the role \c{Qt::UserRole + 1}.
+
+  \sa Esri::ArcGISRuntime::Toolkit::GenericListModel
+ */
+
+/*!
+  \brief Returns the shared metadata table for \a metaObject, building it on
+  first use.
+
+  Returns \c nullptr if \a metaObject is null. This function is thread-safe.
+ */
+const ElementTypeInfo* ElementTypeInfo::forType(const QMetaObject* metaObject)
+{
+  if (!metaObject)
+    return nullptr;
+
+  static QMutex mutex;
+  static std::unordered_map<const QMetaObject*, std::unique_ptr<ElementTypeInfo>> registry;
+
+  QMutexLocker locker(&mutex);
+  auto& info = registry[metaObject];
+  if (!info)
+    info.reset(new ElementTypeInfo(metaObject));
+
+  return info.get();
+}
+
+/*!
+  \internal
+  \brief Builds the metadata table for \a metaObject.
+ */
+ElementTypeInfo::ElementTypeInfo(const QMetaObject* metaObject) :
+  m_metaObject(metaObject)
+{
+  m_roleNames.insert(Qt::UserRole, "modelData");
+
+  const int offset = m_metaObject->propertyOffset();
+  const int count = m_metaObject->propertyCount();
+  m_properties.reserve(count - offset);
+  for (int i = offset; i < count; ++i)
+  {
+    Property p;
+    p.metaProperty = m_metaObject->property(i);
+    p.header = toTitleCase(QString(p.metaProperty.name()));
+    p.notifySignalIndex = p.metaProperty.hasNotifySignal() ? p.metaProperty.notifySignalIndex() : -1;
+    p.writable = p.metaProperty.isWritable();
+    m_properties.append(p);
+
+    m_roleNames.insert(i - offset + Qt::UserRole + 1, p.metaProperty.name());
+  }
+}
+
+/*!
+  \brief Returns the \c QMetaObject this table describes.
+ */
+const QMetaObject* ElementTypeInfo::metaObject() const
+{
+  return m_metaObject;
+}
+
+/*!
+  \brief Returns the number of properties declared on the element type,
+  excluding those inherited from its super-classes.
+ */
+int ElementTypeInfo::propertyCount() const
+{
+  return m_properties.size();
+}
+
+/*!
+  \brief Returns the \c QMetaProperty at relative \a index.
+ */
+const QMetaProperty& ElementTypeInfo::property(int index) const
+{
+  return m_properties.at(index).metaProperty;
+}
+
+/*!
+  \brief Returns the title-cased name of the property at relative \a index,
+  used for table headers.
+ */
+const QString& ElementTypeInfo::header(int index) const
+{
+  return m_properties.at(index).header;
+}
+
+/*!
+  \brief Returns whether the property at relative \a index is writable.
+ */
+bool ElementTypeInfo::isWritable(int index) const
+{
+  return m_properties.at(index).writable;
+}
+
+/*!
+  \brief Returns the method index of the notify signal for the property at
+  relative \a index, or -1 if the property has no notify signal.
+ */
+int ElementTypeInfo::notifySignalIndex(int index) const
+{
+  return m_properties.at(index).notifySignalIndex;
+}
+
+/*!
+  \brief Returns the relative index of the property called \a name, or -1 if
+  the element type declares no such property.
+ */
+int ElementTypeInfo::indexOfProperty(const QByteArray& name) const
+{
+  const int absolute = m_metaObject->indexOfProperty(name.constData());
+  if (absolute < 0)
+    return -1;
+
+  const int relative = absolute - m_metaObject->propertyOffset();
+  return relative < 0 ? -1 : relative;
+}
+
+/*!
+  \brief Returns the role names exposed by a GenericListModel of this element
+  type.
+
+  \sa Esri::ArcGISRuntime::Toolkit::GenericListModel::roleNames
+ */
+const QHash<int, QByteArray>& ElementTypeInfo::roleNames() const
+{
+  return m_roleNames;
+}
+
+} // Toolkit
+} // ArcGISRuntime
+} // Esri
@@ -0,0 +1,74 @@
+/*******************************************************************************
+ *  Copyright 2012-2020 Esri
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+#ifndef ESRI_ARCGISRUNTIME_TOOLKIT_INTERNAL_ELEMENTTYPEINFO_H
+#define ESRI_ARCGISRUNTIME_TOOLKIT_INTERNAL_ELEMENTTYPEINFO_H
+
+// Qt headers
+#include <QByteArray>
+#include <QHash>
+#include <QMetaProperty>
+#include <QString>
+#include <QVector>
+
+namespace Esri
+{
+namespace ArcGISRuntime
+{
+namespace Toolkit
+{
+
+class ElementTypeInfo
+{
+public:
+  static const ElementTypeInfo* forType(const QMetaObject* metaObject);
+
+  const QMetaObject* metaObject() const;
+
+  int propertyCount() const;
+
+  const QMetaProperty& property(int index) const;
+
+  const QString& header(int index) const;
+
+  bool isWritable(int index) const;
+
+  int notifySignalIndex(int index) const;
+
+  int indexOfProperty(const QByteArray& name) const;
+
+  const QHash<int, QByteArray>& roleNames() const;
+
+private:
+  explicit ElementTypeInfo(const QMetaObject* metaObject);
+
+  struct Property
+  {
+    QMetaProperty metaProperty;
+    QString header;
+    int notifySignalIndex = -1;
+    bool writable = false;
+  };
+
+  const QMetaObject* m_metaObject = nullptr;
+  QVector<Property> m_properties;
+  QHash<int, QByteArray> m_roleNames;
+};
+
+} // Toolkit
+} // ArcGISRuntime
+} // Esri
+
+#endif // ESRI_ARCGISRUNTIME_TOOLKIT_INTERNAL_ELEMENTTYPEINFO_H
@@ -0,0 +1,525 @@
+/*******************************************************************************
+ *  Copyright 2012-2020 Esri
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+#include "GadgetListModel.h"
+#include "ElementTypeInfo.h"
+
+#include <QByteArray>
+#include <QMetaProperty>
+#include <QString>
+#include <QStringList>
+
+namespace Esri
+{
+namespace ArcGISRuntime
+{
+namespace Toolkit
+{
+
+/*!
+  \internal
+  \brief The storage of one property of every row of a GadgetListModel.
+
+  Values cross this interface as \c QVariant, already converted to the type
+  of the property, but are stored unboxed where the type allows.
+ */
+class GadgetColumn
+{
+public:
+  virtual ~GadgetColumn() = default;
+
+  virtual QVariant value(int row) const = 0;
+
+  // Returns false, leaving the column untouched, if the value is unchanged.
+  virtual bool setValue(int row, const QVariant& value) = 0;
+
+  virtual void append(const QVariant& value) = 0;
+
+  virtual void insert(int row, int count, const QVariant& value) = 0;
+
+  virtual void remove(int row, int count) = 0;
+
+  virtual void reserve(int size) = 0;
+};
+
+namespace
+{
+
+// A column held as one contiguous vector of T.
+template <typename T>
+class TypedGadgetColumn : public GadgetColumn
+{
+public:
+  QVariant value(int row) const override
+  {
+    return QVariant::fromValue<T>(m_values[row]);
+  }
+
+  bool setValue(int row, const QVariant& value) override
+  {
+    T v = value.value<T>();
+    if (m_values[row] == v)
+      return false;
+
+    m_values[row] = std::move(v);
+    return true;
+  }
+
+  void append(const QVariant& value) override
+  {
+    m_values.push_back(value.value<T>());
+  }
+
+  void insert(int row, int count, const QVariant& value) override
+  {
+    m_values.insert(m_values.begin() + row, count, value.value<T>());
+  }
+
+  void remove(int row, int count) override
+  {
+    const auto first = m_values.begin() + row;
+    m_values.erase(first, first + count);
+  }
+
+  void reserve(int size) override
+  {
+    m_values.reserve(size);
+  }
+
+private:
+  std::vector<T> m_values;
+};
+
+template <typename T>
+std::unique_ptr<GadgetColumn> makeColumn()
+{
+  return std::unique_ptr<GadgetColumn>(new TypedGadgetColumn<T>());
+}
+
+// Returns storage for a property of meta-type userType. Types without a
+// dedicated column are stored boxed.
+std::unique_ptr<GadgetColumn> createColumn(int userType)
+{
+  switch (userType)
+  {
+    case QMetaType::Bool:
+      return makeColumn<bool>();
+    case QMetaType::Int:
+      return makeColumn<int>();
+    case QMetaType::UInt:
+      return makeColumn<uint>();
+    case QMetaType::LongLong:
+      return makeColumn<qlonglong>();
+    case QMetaType::ULongLong:
+      return makeColumn<qulonglong>();
+    case QMetaType::Float:
+      return makeColumn<float>();
+    case QMetaType::Double:
+      return makeColumn<double>();
+    case QMetaType::QString:
+      return makeColumn<QString>();
+    case QMetaType::QByteArray:
+      return makeColumn<QByteArray>();
+    case QMetaType::QStringList:
+      return makeColumn<QStringList>();
+    default:
+      return makeColumn<QVariant>();
+  }
+}
+
+}
+
+/*!
+ \internal
+ \inmodule EsriArcGISRuntimeToolkit
+ \class Esri::ArcGISRuntime::Toolkit::GadgetListModel
+
+ \brief A list model whose elements are \c Q_GADGET value types, stored
+ column-wise.
+
+ GadgetListModel is the value-type counterpart of GenericListModel, intended
+ for large, read-mostly lists where a \c QObject per row is too heavy. Rows
+ have no identity, parent, signals or connections. Instead, each property of
+ the gadget is stored in its own contiguous vector, and a row is only
+ reassembled into a gadget on request.
+
+ Columns are typed by the meta-type of their property. Boolean, integer,
+ floating-point, string, byte array and string list properties are stored
+ unboxed, so a \c double costs eight bytes per row. Properties of any other
+ type are stored as \c QVariant.
+
+ Roles are assigned exactly as in GenericListModel: \c modelData is
+ \c Qt::UserRole and each property declared on the gadget follows from
+ \c{Qt::UserRole + 1} in declaration order.
+
+ Because gadgets cannot notify, all changes must be made through the model
+ with \l setData, which emits \c dataChanged for the affected cell.
+
+ The gadget type must be registered with the meta-type system and be default
+ constructible.
+
+ \sa Esri::ArcGISRuntime::Toolkit::GenericListModel
+ */
+
+/*!
+  \brief Constructor
+  \list
+  \li \a parent Owning parent QObject.
+  \endlist
+ */
+GadgetListModel::GadgetListModel(QObject* parent) :
+  GadgetListModel(nullptr, QMetaType::UnknownType, parent)
+{
+}
+
+/*!
+  \brief Constructor
+  \list
+  \li \a elementType the static meta-object of the gadget type.
+  \li \a metaTypeId the meta-type id of the gadget type.
+  \li \a parent Owning parent QObject.
+  \endlist
+ */
+GadgetListModel::GadgetListModel(const QMetaObject* elementType, int metaTypeId, QObject* parent) :
+  QAbstractListModel(parent)
+{
+  connect(this, &GadgetListModel::rowsInserted, this, &GadgetListModel::countChanged);
+  connect(this, &GadgetListModel::rowsRemoved, this, &GadgetListModel::countChanged);
+  connect(this, &GadgetListModel::modelReset, this, &GadgetListModel::countChanged);
+
+  setElementType(elementType, metaTypeId);
+}
+
+/*!
+  \brief Destructor.
+ */
+GadgetListModel::~GadgetListModel()
+{
+}
+
+/*!
+  \brief Sets the gadget type this model stores, given its static meta-object
+  \a elementType and meta-type id \a metaTypeId.
+
+  This resets the model and discards all rows.
+ */
+void GadgetListModel::setElementType(const QMetaObject* elementType, int metaTypeId)
+{
+  beginResetModel();
+  m_elementType = elementType;
+  m_typeInfo = ElementTypeInfo::forType(elementType);
+  m_metaTypeId = metaTypeId;
+  m_displayColumn = -1;
+  m_rowCount = 0;
+  m_columns.clear();
+  if (m_typeInfo)
+  {
+    const int count = m_typeInfo->propertyCount();
+    m_columns.reserve(count);
+    for (int c = 0; c < count; ++c)
+      m_columns.push_back(createColumn(m_typeInfo->property(c).userType()));
+  }
+  endResetModel();
+}
+
+/*!
+  \brief Returns the static meta-object of the gadget type.
+ */
+const QMetaObject* GadgetListModel::elementType() const
+{
+  return m_elementType;
+}
+
+/*!
+  \brief Sets the property exposed as \c Qt::DisplayRole and \c Qt::EditRole
+  to \a propertyName.
+ */
+void GadgetListModel::setDisplayPropertyName(const QString& propertyName)
+{
+  m_displayColumn = m_typeInfo ? m_typeInfo->indexOfProperty(propertyName.toLatin1()) : -1;
+}
+
+/*!
+  \brief Returns the name of the property exposed as \c Qt::DisplayRole and
+  \c Qt::EditRole.
+ */
+QString GadgetListModel::displayPropertyName() const
+{
+  if (m_displayColumn < 0)
+    return "";
+
+  return m_typeInfo->property(m_displayColumn).name();
+}
+
+/*!
+  \brief Returns the number of rows if \a parent is invalid, otherwise 0.
+ */
+int GadgetListModel::rowCount(const QModelIndex& parent) const
+{
+  return parent.isValid() ? 0 : m_rowCount;
+}
+
+/*!
+  \brief Returns the value stored for \a role at \a index.
+
+  \c Qt::UserRole returns the whole row reassembled as a gadget.
+ */
+QVariant GadgetListModel::data(const QModelIndex& index, int role) const
+{
+  if (!index.isValid() || index.row() >= m_rowCount)
+    return QVariant();
+
+  if (role == Qt::UserRole)
+    return gadget(index.row());
+
+  const int column = columnForRole(role);
+  if (column < 0)
+    return QVariant();
+
+  return m_columns[column]->value(index.row());
+}
+
+/*!
+  \brief Sets the value for \a role at \a index to \a value.
+
+  \a value is converted to the type of the property. Setting
+  \c Qt::UserRole replaces the whole row with the gadget held in \a value.
+
+  Returns \c true if the value could be stored. \c dataChanged is only
+  emitted if the stored value changed.
+ */
+bool GadgetListModel::setData(const QModelIndex& index, const QVariant& value, int role)
+{
+  if (!index.isValid() || index.row() >= m_rowCount)
+    return false;
+
+  const int row = index.row();
+  if (role == Qt::UserRole)
+  {
+    if (value.userType() != m_metaTypeId)
+      return false;
+
+    const void* g = value.constData();
+    for (size_t c = 0; c < m_columns.size(); ++c)
+      m_columns[c]->setValue(row, m_typeInfo->property(static_cast<int>(c)).readOnGadget(g));
+
+    emit dataChanged(index, index);
+    return true;
+  }
+
+  const int column = columnForRole(role);
+  if (column < 0)
+    return false;
+
+  QVariant converted = value;
+  if (!converted.convert(m_typeInfo->property(column).userType()))
+    return false;
+
+  if (!m_columns[column]->setValue(row, converted))
+    return true;
+
+  const int changedRole = column + Qt::UserRole + 1;
+  if (column == m_displayColumn)
+    emit dataChanged(index, index, { Qt::UserRole, changedRole, Qt::DisplayRole, Qt::EditRole });
+  else
+    emit dataChanged(index, index, { Qt::UserRole, changedRole });
+
+  return true;
+}
+
+/*!
+  \brief Returns the role names, which match those of a GenericListModel for
+  the same property layout.
+ */
+QHash<int, QByteArray> GadgetListModel::roleNames() const
+{
+  if (!m_typeInfo)
+    return { };
+
+  return m_typeInfo->roleNames();
+}
+
+/*!
+  \brief Inserts \a count default constructed gadgets at \a row.
+
+  \a parent must be invalid. Returns \c true on success.
+ */
+bool GadgetListModel::insertRows(int row, int count, const QModelIndex& parent)
+{
+  if (!m_typeInfo || parent.isValid() || count < 1 || row < 0 || row > m_rowCount)
+    return false;
+
+  const QVariant defaultGadget(m_metaTypeId, nullptr);
+  if (!defaultGadget.isValid())
+    return false;
+
+  beginInsertRows(parent, row, row + count - 1);
+  for (size_t c = 0; c < m_columns.size(); ++c)
+  {
+    const auto value = m_typeInfo->property(static_cast<int>(c)).readOnGadget(defaultGadget.constData());
+    m_columns[c]->insert(row, count, value);
+  }
+  m_rowCount += count;
+  endInsertRows();
+  return true;
+}
+
+/*!
+  \brief Removes \a count rows starting at \a row.
+
+  \a parent must be invalid. Returns \c true on success.
+ */
+bool GadgetListModel::removeRows(int row, int count, const QModelIndex& parent)
+{
+  if (parent.isValid() || count < 0 || row < 0 || row + count > m_rowCount)
+    return false;
+  else if (count == 0)
+    return true;
+
+  beginRemoveRows(parent, row, row + count - 1);
+  for (auto& column : m_columns)
+    column->remove(row, count);
+
+  m_rowCount -= count;
+  endRemoveRows();
+  return true;
+}
+
+/*!
+  \brief Appends the gadget held in \a gadget to the model.
+
+  Returns \c false if \a gadget does not hold the element type.
+ */
+bool GadgetListModel::append(const QVariant& gadget)
+{
+  return append(QVariantList{gadget});
+}
+
+/*!
+  \brief Appends all \a gadgets to the model.
+
+  Returns \c false, and appends nothing, if any value does not hold the
+  element type.
+ */
+bool GadgetListModel::append(const QVariantList& gadgets)
+{
+  if (!m_typeInfo)
+    return false;
+
+  const int size = gadgets.size();
+  if (size < 1)
+    return true;
+
+  for (const auto& g : gadgets)
+  {
+    if (g.userType() != m_metaTypeId)
+      return false;
+  }
+
+  beginInsertRows(QModelIndex(), m_rowCount, m_rowCount + size - 1);
+  for (auto& column : m_columns)
+    column->reserve(m_rowCount + size);
+
+  for (const auto& g : gadgets)
+    appendRow(g.constData());
+
+  m_rowCount += size;
+  endInsertRows();
+  return true;
+}
+
+/*!
+  \brief Returns the row at \a row reassembled as a gadget held in a
+  \c QVariant, or an invalid \c QVariant if \a row is out of range.
+ */
+QVariant GadgetListModel::gadget(int row) const
+{
+  if (row < 0 || row >= m_rowCount)
+    return QVariant();
+
+  QVariant result(m_metaTypeId, nullptr);
+  void* g = result.data();
+  for (size_t c = 0; c < m_columns.size(); ++c)
+  {
+    const int i = static_cast<int>(c);
+    if (m_typeInfo->isWritable(i))
+      m_typeInfo->property(i).writeOnGadget(g, m_columns[c]->value(row));
+  }
+  return result;
+}
+
+/*!
+  \internal
+  \brief Returns the number of rows for the count property.
+ */
+int GadgetListModel::count() const
+{
+  return m_rowCount;
+}
+
+/*!
+  \internal
+  \brief Returns the column storing \a role, or -1 if there is none.
+ */
+int GadgetListModel::columnForRole(int role) const
+{
+  if (role == Qt::DisplayRole || role == Qt::EditRole)
+    return m_displayColumn;
+
+  const int column = role - (Qt::UserRole + 1);
+  if (column < 0 || column >= static_cast<int>(m_columns.size()))
+    return -1;
+
+  return column;
+}
+
+/*!
+  \internal
+  \brief Reads each property of \a gadget onto the end of its column.
+ */
+void GadgetListModel::appendRow(const void* gadget)
+{
+  for (size_t c = 0; c < m_columns.size(); ++c)
+    m_columns[c]->append(m_typeInfo->property(static_cast<int>(c)).readOnGadget(gadget));
+}
+
+/*!
+  \fn template <typename G> void Esri::ArcGISRuntime::Toolkit::GadgetListModel::setElementType()
+  \brief Sets the element type to the gadget \c G.
+ */
+
+/*!
+  \fn template <typename G> bool Esri::ArcGISRuntime::Toolkit::GadgetListModel::append(const G& gadget)
+  \brief Appends \a gadget to the model.
+ */
+
+/*!
+  \fn template <typename G> G Esri::ArcGISRuntime::Toolkit::GadgetListModel::element(int row) const
+  \brief Returns the row at \a row as a gadget of type \c G.
+ */
+
+/*!
+  \fn void Esri::ArcGISRuntime::Toolkit::GadgetListModel::countChanged()
+  \brief Emitted when the number of rows changes.
+ */
+
+/*!
+  \property Esri::ArcGISRuntime::Toolkit::GadgetListModel::count
+  \brief The current number of rows in this model.
+ */
+
+} // Toolkit
+} // ArcGISRuntime
+} // Esri
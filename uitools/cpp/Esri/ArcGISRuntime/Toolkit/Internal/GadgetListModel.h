@@ -0,0 +1,116 @@
+/*******************************************************************************
+ *  Copyright 2012-2020 Esri
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+#ifndef ESRI_ARCGISRUNTIME_TOOLKIT_INTERNAL_GADGETLISTMODEL_H
+#define ESRI_ARCGISRUNTIME_TOOLKIT_INTERNAL_GADGETLISTMODEL_H
+
+// Qt headers
+#include <QAbstractListModel>
+#include <QMetaObject>
+#include <QVariant>
+
+// std headers
+#include <memory>
+#include <vector>
+
+namespace Esri
+{
+namespace ArcGISRuntime
+{
+namespace Toolkit
+{
+
+class ElementTypeInfo;
+class GadgetColumn;
+
+class GadgetListModel : public QAbstractListModel
+{
+  Q_OBJECT
+  Q_PROPERTY(int count READ count NOTIFY countChanged)
+public:
+  explicit Q_INVOKABLE GadgetListModel(QObject* parent = nullptr);
+
+  GadgetListModel(const QMetaObject* elementType, int metaTypeId, QObject* parent = nullptr);
+
+  ~GadgetListModel() override;
+
+  void setElementType(const QMetaObject* elementType, int metaTypeId);
+
+  template <typename G>
+  void setElementType()
+  {
+    setElementType(&G::staticMetaObject, qMetaTypeId<G>());
+  }
+
+  const QMetaObject* elementType() const;
+
+  void setDisplayPropertyName(const QString& propertyName);
+
+  QString displayPropertyName() const;
+
+  int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+
+  QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+
+  bool setData(const QModelIndex& index, const QVariant& value, int role = Qt::EditRole) override;
+
+  QHash<int, QByteArray> roleNames() const override;
+
+  bool insertRows(int row, int count, const QModelIndex& parent = QModelIndex()) override;
+
+  bool removeRows(int row, int count, const QModelIndex& parent = QModelIndex()) override;
+
+  Q_INVOKABLE bool append(const QVariant& gadget);
+
+  bool append(const QVariantList& gadgets);
+
+  template <typename G>
+  bool append(const G& gadget)
+  {
+    return append(QVariant::fromValue(gadget));
+  }
+
+  Q_INVOKABLE QVariant gadget(int row) const;
+
+  template <typename G>
+  G element(int row) const
+  {
+    return qvariant_cast<G>(gadget(row));
+  }
+
+signals:
+  void countChanged();
+
+private:
+  int count() const;
+
+  int columnForRole(int role) const;
+
+  void appendRow(const void* gadget);
+
+private:
+  const QMetaObject* m_elementType = nullptr;
+  const ElementTypeInfo* m_typeInfo = nullptr;
+  int m_metaTypeId = QMetaType::UnknownType;
+  int m_displayColumn = -1;
+  int m_rowCount = 0;
+  std::vector<std::unique_ptr<GadgetColumn>> m_columns;
+};
+
+} // Toolkit
+} // ArcGISRuntime
+} // Esri
+
+#endif // ESRI_ARCGISRUNTIME_TOOLKIT_INTERNAL_GADGETLISTMODEL_H
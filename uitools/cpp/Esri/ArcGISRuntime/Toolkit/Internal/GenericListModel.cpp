@@ -14,10 +14,17 @@
  *  limitations under the License.
  ******************************************************************************/
 #include "GenericListModel.h"
-#include "MetaElement.h"
+#include "ElementTypeInfo.h"
+#include "SignalDispatcher.h"
 
+#include <QMetaMethod>
 #include <QMetaProperty>
 #include <QPointer>
+#include <QSet>
+#include <QTimer>
+
+#include <algorithm>
+#include <vector>
 
 namespace Esri
 {
@@ -26,6 +33,115 @@ namespace ArcGISRuntime
 namespace Toolkit
 {
 
+namespace
+{
+
+enum class EditType
+{
+  Keep,
+  Remove,
+  Insert
+};
+
+struct EditRun
+{
+  EditType type;
+  int length;
+};
+
+// Beyond this many edits the two lists are considered unrelated, and the
+// differing span is replaced wholesale rather than diffed.
+constexpr int MaxEditDistance = 1024;
+
+void appendRun(std::vector<EditRun>& runs, EditType type, int length)
+{
+  if (length < 1)
+    return;
+
+  if (!runs.empty() && runs.back().type == type)
+    runs.back().length += length;
+  else
+    runs.push_back({type, length});
+}
+
+/*
+  \internal
+  \brief Computes the shortest edit script turning \a a into \a b using
+  Myers' O((N+M)D) algorithm, and writes it to \a runs as runs of kept,
+  removed and inserted elements.
+
+  Returns \c false, leaving \a runs untouched, if the edit distance exceeds
+  MaxEditDistance.
+ */
+bool shortestEditScript(const std::vector<const QObject*>& a,
+                        const std::vector<const QObject*>& b,
+                        std::vector<EditRun>& runs)
+{
+  const int n = static_cast<int>(a.size());
+  const int m = static_cast<int>(b.size());
+  const int max = n + m;
+  const int limit = std::min(max, MaxEditDistance);
+  const int offset = max + 1;
+
+  // v[offset + k] is the furthest x reached on diagonal k. trace[d] keeps the
+  // diagonals -d..d of v after step d, which is all the backtrack needs.
+  std::vector<int> v(2 * max + 3, 0);
+  std::vector<std::vector<int>> trace;
+  int distance = -1;
+  for (int d = 0; d <= limit && distance < 0; ++d)
+  {
+    for (int k = -d; k <= d; k += 2)
+    {
+      int x = (k == -d || (k != d && v[offset + k - 1] < v[offset + k + 1]))
+          ? v[offset + k + 1]
+          : v[offset + k - 1] + 1;
+      int y = x - k;
+      while (x < n && y < m && a[x] == b[y])
+      {
+        ++x;
+        ++y;
+      }
+      v[offset + k] = x;
+      if (x >= n && y >= m)
+      {
+        distance = d;
+        break;
+      }
+    }
+    trace.emplace_back(v.begin() + offset - d, v.begin() + offset + d + 1);
+  }
+
+  if (distance < 0)
+    return false;
+
+  // Walk back from (n, m) collecting the script in reverse.
+  std::vector<EditRun> reversed;
+  int x = n;
+  int y = m;
+  for (int d = distance; d > 0; --d)
+  {
+    const auto& previous = trace[d - 1];
+    auto furthest = [&previous, d](int k) { return previous[k + d - 1]; };
+
+    const int k = x - y;
+    const bool down = k == -d || (k != d && furthest(k - 1) < furthest(k + 1));
+    const int previousK = down ? k + 1 : k - 1;
+    const int previousX = furthest(previousK);
+    const int previousY = previousX - previousK;
+
+    appendRun(reversed, EditType::Keep, down ? x - previousX : x - previousX - 1);
+    appendRun(reversed, down ? EditType::Insert : EditType::Remove, 1);
+    x = previousX;
+    y = previousY;
+  }
+  appendRun(reversed, EditType::Keep, x);
+
+  runs.assign(reversed.rbegin(), reversed.rend());
+  return true;
+}
+
+}
+
 /*!
  \internal 
  \inmodule EsriArcGISRuntimeToolkit
@@ -85,6 +201,10 @@ namespace Toolkit
  Both \c data and \c setData can be called respectively on these roles.
  Likewise, every time a property updates, the notify signal will be consumed
  and this model will emit a dataChanged signal.
+
+ When batching is enabled with \l setBatchingEnabled, notify signals are
+ instead collected until the next turn of the event loop (or an explicit call
+ to \l flush) and emitted as the fewest possible \c dataChanged signals.
  
  The class definition for a given \c QObject must have
  a constructor of form \c{Q_INVOKABLE Foo(QObject* parent = nullptr)}.
@@ -115,7 +235,16 @@ GenericListModel::GenericListModel(QObject* parent) :
  */
 GenericListModel::GenericListModel(const QMetaObject* elementType, QObject* parent) :
   QAbstractListModel(parent),
-  m_elementType(elementType)
+  m_elementType(elementType),
+  m_typeInfo(ElementTypeInfo::forType(elementType)),
+  m_dispatcher(new SignalDispatcher(
+    [this](QObject* element, int id)
+    {
+      if (id == destroyedId())
+        elementDestroyed(element);
+      else
+        elementPropertyChanged(element, id);
+    }, this))
 {
   connect(this, &GenericListModel::rowsInserted, this, &GenericListModel::countChanged);
   connect(this, &GenericListModel::rowsRemoved, this, &GenericListModel::countChanged);
@@ -128,17 +257,13 @@ GenericListModel::GenericListModel(const QMetaObject* elementType, QObject* pare
     [this](const QModelIndex& topLeft, const QModelIndex& bottomRight,
        const QVector<int>& roles)
   {
-    if (m_displayPropIndex < 0)
-      return;
-
-    if (!m_elementType)
+    if (m_displayRole < 0)
       return;
 
     if (roles.contains(Qt::DisplayRole))
       return;
 
-    const auto offset = m_elementType->propertyOffset();
-    if (roles.contains(m_displayPropIndex - offset + Qt::UserRole +1))
+    if (roles.contains(m_displayRole))
       emit dataChanged(topLeft, bottomRight, QVector<int>() << Qt::DisplayRole << Qt::EditRole);
   });
 }
@@ -197,10 +322,12 @@ QVariant GenericListModel::data(const QModelIndex& index, int role) const
     return QVariant();
 
   auto o = m_objects.at(index.row());
+  if (!o)
+    return QVariant(); // Destroyed, awaiting removal.
+
   if (role == Qt::DisplayRole || role == Qt::EditRole)
   {
-    const auto property = m_elementType->property(m_displayPropIndex);
-    return property.read(o);
+    return m_displayProperty.read(o);
   }
   else if (role == Qt::UserRole)
   {
@@ -208,9 +335,11 @@ QVariant GenericListModel::data(const QModelIndex& index, int role) const
   }
   else if (role >= Qt::UserRole)
   {
-    const auto propIndex = role - (Qt::UserRole + 1) + m_elementType->propertyOffset();
-    const auto property = m_elementType->property(propIndex);
-    return property.read(o);
+    const auto propIndex = role - (Qt::UserRole + 1);
+    if (propIndex >= m_typeInfo->propertyCount())
+      return QVariant();
+
+    return m_typeInfo->property(propIndex).read(o);
   }
 
   return QVariant();
@@ -227,7 +356,8 @@ QVariant GenericListModel::data(const QModelIndex& index, int role) const
   
   If the role is \c Qt::UserRole, then we attempt to cast the QVariant to
   the type defined by elementType, and replace the object in the model with
-  this new object.
+  this new object. The replaced object is disconnected from this model but
+  not deleted. An object already held at another row is rejected.
   
   If the role is is any value greater than \c Qt::UserRole, then the role is
   mapped to the property in the object associated with that role. See
@@ -251,29 +381,43 @@ bool GenericListModel::setData(const QModelIndex& index, const QVariant& value,
   if (role == Qt::DisplayRole || role == Qt::EditRole)
   {
     auto o = m_objects.at(index.row());
-    const auto property = m_elementType->property(m_displayPropIndex);
-    return property.write(o, value);
+    return o && m_displayProperty.write(o, value);
   }
   else if (role == Qt::UserRole)
   {
     auto newObject = qvariant_cast<QObject*>(value);
-    if (newObject && m_elementType == newObject->metaObject())
-    {
-      m_objects[index.row()] = newObject;
-      emit dataChanged(index, index);
+    if (!newObject || m_elementType != newObject->metaObject())
+      return false;
+
+    const int row = index.row();
+    auto oldObject = m_objects.at(row);
+    if (oldObject == newObject)
       return true;
-    }
-    else
+    else if (rowOf(newObject) >= 0)
+      return false; // Already held at another row.
+
+    if (oldObject)
     {
-      return false;
+      disconnect(oldObject, nullptr, m_dispatcher, nullptr);
+      m_rows.remove(oldObject);
     }
+
+    m_objects[row] = newObject;
+    if (row < m_indexedRows)
+      m_rows.insert(newObject, row);
+
+    connectElement(index);
+    emit dataChanged(index, index);
+    return true;
   }
   else if (role > Qt::UserRole)
   {
+    const auto propIndex = role - (Qt::UserRole + 1);
+    if (propIndex >= m_typeInfo->propertyCount())
+      return false;
+
     auto o = m_objects.at(index.row());
-    const auto propIndex = role - (Qt::UserRole + 1) + m_elementType->propertyOffset();
-    const auto property = m_elementType->property(propIndex);
-    return property.write(o, value);
+    return o && m_typeInfo->property(propIndex).write(o, value);
   }
 
   return false;
@@ -311,26 +455,17 @@ bool GenericListModel::setData(const QModelIndex& index, const QVariant& value,
      \li \c{ Qt::UserRole + 3}
   \endtable
 
+  The role names are computed once per element type and shared between
+  models.
+
   \sa elementType
  */
 QHash<int, QByteArray> GenericListModel::roleNames() const
 {
-  if (!m_elementType)
+  if (!m_typeInfo)
     return { };
 
-  QHash<int, QByteArray> output;
-  output.insert( Qt::UserRole, "modelData");
-
-  const int offset = m_elementType->propertyOffset();
-  for (int i = offset; i < m_elementType->propertyCount(); ++i)
-  {
-    // Each property has a name and an index which starts from an arbitrary
-    // offset. So we have properties at indices: OFFSET, OFFSET+1, OFFSET+2....
-    // We map OFFSET to, Qt::UserRole+1, OFFSET+1 to Qt::UserRole+2 and so on.
-    auto property = m_elementType->property(i);
-    output.insert(i - offset + Qt::UserRole + 1, property.name());
-  }
-  return output;
+  return m_typeInfo->roleNames();
 }
 
 /*!
@@ -344,6 +479,13 @@ QHash<int, QByteArray> GenericListModel::roleNames() const
   \endcode
   
   Otherwise behaviour is undefined.
+
+  All objects are constructed up-front, spliced into the list in a single
+  pass, and then have their notifications wired for the whole inserted range.
+  If recycling is enabled, previously removed objects are reused before new
+  ones are constructed.
+
+  \sa setRecyclingCapacity
   
   \list
   \li \a row Row to start insertion at.
@@ -366,22 +508,49 @@ bool GenericListModel::insertRows(int row, int count, const QModelIndex& parent)
   else if (row > m_objects.size())
     return false;
 
-  beginInsertRows(parent, row, row + count - 1);
+  QList<QObject*> created;
+  created.reserve(count);
   for (int i = 0; i < count; ++i)
   {
-    m_objects.insert(row, m_elementType->newInstance(Q_ARG(QObject*, this)));
+    auto o = createElement();
+    if (!o)
+    {
+      // Element type is not default constructible with a parent. Recycled
+      // objects go back to the pool rather than being deleted.
+      for (auto c : created)
+        releaseElement(c);
+
+      return false;
+    }
+    created.append(o);
   }
-  endInsertRows();
 
-  for (int i = row; i < count; ++i)
+  flush();
+  beginInsertRows(parent, row, row + count - 1);
+  if (row == m_objects.size())
   {
-    connectElement(index(row));
+    m_objects.append(created);
   }
+  else
+  {
+    QList<QObject*> objects;
+    objects.reserve(m_objects.size() + count);
+    objects.append(m_objects.mid(0, row));
+    objects.append(created);
+    objects.append(m_objects.mid(row));
+    m_objects.swap(objects);
+    m_indexedRows = std::min(m_indexedRows, row);
+  }
+  endInsertRows();
+
+  connectElements(row, row + count - 1);
   return true;
 }
 
 /*!
   \brief Removes and deletes the range of objects defined by row and count.
+
+  The range is erased from the list in a single operation.
  
   \list 
   \li \a row Start index for deletion.
@@ -406,20 +575,16 @@ bool GenericListModel::removeRows(int row, int count, const QModelIndex& parent)
   else if (count == 0)
     return true; // A valid no-op.
 
+  flush();
   beginRemoveRows(parent, row, row + count - 1);
-  for (int i = count - 1; i >= row; --i)
-  {
-    auto o = m_objects.at(i);
-
-    // Ensure additional removal signals are not triggered.
-    if (o)
-      disconnect(o, &QObject::destroyed, this, nullptr);
+  const auto removed = takeRows(row, count);
+  endRemoveRows();
 
-    delete o;
+  // Objects are released only once they are out of the list, so their
+  // destroyed signals are ignored.
+  for (auto o : removed)
+    releaseElement(o);
 
-    m_objects.removeAt(i);
-  }
-  endRemoveRows();
   return true;
 }
 
@@ -436,18 +601,23 @@ bool GenericListModel::removeRows(int row, int count, const QModelIndex& parent)
  */
 void GenericListModel::setElementType(const QMetaObject* metaObject)
 {
+  m_pendingChanges.clear();
   beginResetModel();
-  for (auto o : m_objects)
-  {
-    // Ensure additional removal signals are not triggered.
-    if (o)
-      disconnect(o, &QObject::destroyed, this, nullptr);
+  QList<QObject*> objects;
+  objects.swap(m_objects);
+  m_rows.clear();
+  m_indexedRows = 0;
 
-    delete o;
-  }
-  m_objects.clear();
+  // The list is already empty, so destroyed signals are ignored.
+  qDeleteAll(objects);
+  qDeleteAll(m_pool);
+  m_pool.clear();
+  delete m_prototype;
+  m_prototype = nullptr;
   m_elementType = metaObject;
-  m_displayPropIndex = -1;
+  m_typeInfo = ElementTypeInfo::forType(metaObject);
+  m_displayProperty = QMetaProperty();
+  m_displayRole = -1;
   endResetModel();
 }
 
@@ -462,6 +632,17 @@ const QMetaObject* GenericListModel::elementType() const
   return m_elementType;
 }
 
+/*!
+  \brief Returns the cached property metadata for the current element type,
+  or \c nullptr if no element type is set.
+
+  \sa Esri::ArcGISRuntime::Toolkit::ElementTypeInfo
+ */
+const ElementTypeInfo* GenericListModel::elementTypeInfo() const
+{
+  return m_typeInfo;
+}
+
 /*!
   \brief The name of the property which is to be exposed as both the
   display role and the edit role.
@@ -478,7 +659,20 @@ const QMetaObject* GenericListModel::elementType() const
  */
 void GenericListModel::setDisplayPropertyName(const QString& propertyName)
 {
-  m_displayPropIndex = m_elementType->indexOfProperty(propertyName.toLatin1());
+  if (!m_elementType)
+    return;
+
+  const int propIndex = m_elementType->indexOfProperty(propertyName.toLatin1());
+  if (propIndex < 0)
+  {
+    m_displayProperty = QMetaProperty();
+    m_displayRole = -1;
+    return;
+  }
+
+  m_displayProperty = m_elementType->property(propIndex);
+  const int relativeIndex = propIndex - m_elementType->propertyOffset();
+  m_displayRole = relativeIndex < 0 ? -1 : relativeIndex + Qt::UserRole + 1;
 }
 
 /*!
@@ -489,10 +683,10 @@ void GenericListModel::setDisplayPropertyName(const QString& propertyName)
   */
 QString GenericListModel::displayPropertyName()
 {
-  if (m_displayPropIndex < 0)
+  if (!m_displayProperty.isValid())
     return "";
 
-  return m_elementType->property(m_displayPropIndex).name();
+  return m_displayProperty.name();
 }
 
 /*!
@@ -561,12 +755,348 @@ bool GenericListModel::append(QList<QObject*> objects)
   m_objects << objects;
   endInsertRows();
 
-  for (; i < size; ++i)
-    connectElement(index(i));
+  connectElements(i, i + size - 1);
+  return true;
+}
+
+/*!
+  \brief Replaces the contents of this list with \a objects, emitting the
+  fewest row insertions, removals and moves needed to get there.
+
+  Rather than resetting the model, the current list and \a objects are
+  compared. After trimming the common head and tail, the differing span is
+  diffed with Myers' algorithm, which runs in time proportional to the size of
+  the lists multiplied by the number of edits. Attached views therefore keep
+  their delegates, selection and scroll position for every object which is
+  in both lists.
+
+  Objects which are only in the current list are removed and deleted as with
+  \l removeRows. Objects which are in both lists but change position are
+  moved to their new row, with adjacent objects moved together. If the lists
+  differ by more than a thousand or so edits the differing span is removed
+  and re-inserted as a whole instead; objects in both lists are not deleted.
+
+  The update fails, and the model is left unchanged, if any object is null,
+  appears more than once, or has a MetaType that does not match elementType.
+
+  \list
+  \li \a objects The new contents of this model.
+  \endlist
+
+  Returns \c true if the contents were replaced.
+ */
+bool GenericListModel::setObjects(QList<QObject*> objects)
+{
+  if (!m_elementType)
+    return false;
+
+  QSet<const QObject*> incoming;
+  incoming.reserve(objects.size());
+  for (auto o : objects)
+  {
+    if (!o)
+      return false;
+    else if (o->metaObject() != m_elementType)
+      return false;
+
+    incoming.insert(o);
+  }
+
+  if (incoming.size() != objects.size())
+    return false; // Duplicates.
+
+  const int oldSize = m_objects.size();
+  const int newSize = objects.size();
+
+  int prefix = 0;
+  while (prefix < oldSize && prefix < newSize && m_objects.at(prefix) == objects.at(prefix))
+    ++prefix;
+
+  int suffix = 0;
+  while (suffix < oldSize - prefix && suffix < newSize - prefix &&
+         m_objects.at(oldSize - 1 - suffix) == objects.at(newSize - 1 - suffix))
+    ++suffix;
+
+  const int n = oldSize - prefix - suffix;
+  const int m = newSize - prefix - suffix;
+  if (n == 0 && m == 0)
+    return true; // Nothing changed.
 
+  std::vector<const QObject*> before(m_objects.cbegin() + prefix, m_objects.cbegin() + prefix + n);
+  std::vector<const QObject*> after(objects.cbegin() + prefix, objects.cbegin() + prefix + m);
+
+  std::vector<EditRun> runs;
+  const bool diffed = shortestEditScript(before, after, runs);
+
+  flush();
+
+  if (!diffed)
+  {
+    // Objects in both lists are reconnected when they are inserted again.
+    if (n > 0)
+    {
+      beginRemoveRows(QModelIndex(), prefix, prefix + n - 1);
+      const auto removed = takeRows(prefix, n);
+      endRemoveRows();
+
+      for (auto o : removed)
+      {
+        if (incoming.contains(o))
+          disconnect(o, nullptr, m_dispatcher, nullptr);
+        else
+          releaseElement(o);
+      }
+    }
+
+    insertObjects(prefix, objects.mid(prefix, m));
+    return true;
+  }
+
+  // Objects on the common subsequence keep their rows, every other object in
+  // both lists is moved.
+  QSet<const QObject*> kept;
+  int source = 0;
+  for (const auto& run : runs)
+  {
+    if (run.type == EditType::Keep)
+    {
+      for (int i = 0; i < run.length; ++i)
+        kept.insert(before[source + i]);
+    }
+    if (run.type != EditType::Insert)
+      source += run.length;
+  }
+  const QSet<const QObject*> outgoing(before.cbegin(), before.cend());
+
+  // Remove the objects which are not in the new list, last run first.
+  int last = prefix + n - 1;
+  while (last >= prefix)
+  {
+    if (incoming.contains(m_objects.at(last)))
+    {
+      --last;
+      continue;
+    }
+
+    int first = last;
+    while (first > prefix && !incoming.contains(m_objects.at(first - 1)))
+      --first;
+
+    beginRemoveRows(QModelIndex(), first, last);
+    const auto removed = takeRows(first, last - first + 1);
+    endRemoveRows();
+
+    for (auto o : removed)
+      releaseElement(o);
+    last = first - 1;
+  }
+
+  // Walk the new list in order, placing each object directly after the
+  // previous one. Only objects still to be moved can sit between the anchor
+  // and the next kept object.
+  int anchor = prefix - 1;
+  int i = 0;
+  while (i < m)
+  {
+    const QObject* target = after[i];
+    if (kept.contains(target))
+    {
+      int row = anchor + 1;
+      while (m_objects.at(row) != target)
+        ++row;
+      anchor = row;
+      ++i;
+    }
+    else if (!outgoing.contains(target))
+    {
+      int count = 1;
+      while (i + count < m && !outgoing.contains(after[i + count]))
+        ++count;
+
+      insertObjects(anchor + 1, objects.mid(prefix + i, count));
+      anchor += count;
+      i += count;
+    }
+    else
+    {
+      const int from = static_cast<int>(std::find(m_objects.cbegin() + prefix, m_objects.cend(), target) - m_objects.cbegin());
+
+      // Objects which are adjacent in both lists move together.
+      int count = 1;
+      while (i + count < m && from + count < m_objects.size() &&
+             m_objects.at(from + count) == after[i + count] &&
+             !kept.contains(after[i + count]))
+        ++count;
+
+      const int destination = anchor + 1;
+      if (from != destination)
+      {
+        beginMoveRows(QModelIndex(), from, from + count - 1, QModelIndex(), destination);
+        const auto begin = m_objects.begin();
+        if (from > destination)
+          std::rotate(begin + destination, begin + from, begin + from + count);
+        else
+          std::rotate(begin + from, begin + from + count, begin + destination);
+        m_indexedRows = std::min(m_indexedRows, std::min(from, destination));
+        endMoveRows();
+      }
+
+      // A block moved down ends at the anchor, which shifts up by its size.
+      if (from >= destination)
+        anchor += count;
+      i += count;
+    }
+  }
   return true;
 }
 
+/*!
+  \brief Sets the maximum number of removed elements kept for reuse to
+  \a capacity.
+
+  When the capacity is greater than zero, objects removed with
+  \l removeRows that are owned by this model are not deleted. They are
+  disconnected from this model and kept in a pool, and \l insertRows takes
+  objects from the pool before constructing new ones. Recycled objects have
+  their writable properties reset to those of a default constructed element.
+
+  \note Connections that third parties made to a removed object are not
+  severed when it is pooled. Only enable recycling for element types whose
+  objects are not connected to from outside the model.
+
+  Setting the capacity to \c 0 (the default) disables recycling and deletes
+  any pooled objects.
+ */
+void GenericListModel::setRecyclingCapacity(int capacity)
+{
+  m_poolCapacity = std::max(0, capacity);
+  while (m_pool.size() > m_poolCapacity)
+    delete m_pool.takeLast();
+}
+
+/*!
+  \brief Returns the maximum number of removed elements kept for reuse.
+  \sa setRecyclingCapacity
+ */
+int GenericListModel::recyclingCapacity() const
+{
+  return m_poolCapacity;
+}
+
+/*!
+  \internal
+  \brief Returns a new element owned by this model, reusing a pooled element
+  if one is available.
+
+  Returns \c nullptr if the element type cannot be constructed.
+ */
+QObject* GenericListModel::createElement()
+{
+  if (m_pool.isEmpty())
+    return m_elementType->newInstance(Q_ARG(QObject*, this));
+
+  auto o = m_pool.takeLast();
+
+  // Reset the recycled object to the state of a freshly constructed one.
+  if (!m_prototype)
+    m_prototype = m_elementType->newInstance(Q_ARG(QObject*, this));
+
+  if (m_prototype)
+  {
+    const int count = m_typeInfo->propertyCount();
+    for (int i = 0; i < count; ++i)
+    {
+      const auto& property = m_typeInfo->property(i);
+      if (m_typeInfo->isWritable(i) && property.isStored())
+        property.write(o, property.read(m_prototype));
+    }
+  }
+  return o;
+}
+
+/*!
+  \internal
+  \brief Deletes element \a o, or moves it into the recycling pool if
+  recycling is enabled and this model owns it.
+ */
+void GenericListModel::releaseElement(QObject* o)
+{
+  if (!o)
+    return;
+
+  if (m_pool.size() < m_poolCapacity && o->parent() == this &&
+      o->metaObject() == m_elementType)
+  {
+    disconnect(o, nullptr, this, nullptr);
+    disconnect(o, nullptr, m_dispatcher, nullptr);
+    m_pool.append(o);
+  }
+  else
+  {
+    delete o;
+  }
+}
+
+/*!
+  \internal
+  \brief Erases \a count rows starting at \a row from the list and row index
+  in one operation, and returns the objects that were held there.
+
+  Callers must wrap this in beginRemoveRows and endRemoveRows, and release
+  the returned objects afterwards.
+ */
+QList<QObject*> GenericListModel::takeRows(int row, int count)
+{
+  const auto first = m_objects.begin() + row;
+  const auto last = first + count;
+  QList<QObject*> removed;
+  removed.reserve(count);
+  for (auto it = first; it != last; ++it)
+  {
+    m_rows.remove(*it);
+    removed.append(*it);
+  }
+  m_objects.erase(first, last);
+  m_indexedRows = std::min(m_indexedRows, row);
+  return removed;
+}
+
+/*!
+  \internal
+  \brief Inserts \a objects at \a row and connects them to this model.
+ */
+void GenericListModel::insertObjects(int row, const QList<QObject*>& objects)
+{
+  if (objects.isEmpty())
+    return;
+
+  QList<QObject*> spliced;
+  spliced.reserve(m_objects.size() + objects.size());
+  spliced.append(m_objects.mid(0, row));
+  spliced.append(objects);
+  spliced.append(m_objects.mid(row));
+
+  const int last = row + objects.size() - 1;
+  beginInsertRows(QModelIndex(), row, last);
+  m_objects.swap(spliced);
+  m_indexedRows = std::min(m_indexedRows, row);
+  endInsertRows();
+
+  connectElements(row, last);
+}
+
+/*!
+  \internal
+  \brief Connects every element between rows \a first and \a last
+  inclusive.
+  \sa connectElement
+ */
+void GenericListModel::connectElements(int first, int last)
+{
+  for (int i = first; i <= last; ++i)
+    connectElement(index(i));
+}
+
 /*!
   \internal 
   
@@ -577,6 +1107,10 @@ bool GenericListModel::append(QList<QObject*> objects)
   
   We also connect up to each notify signal on each property, so we can
   emit a \l dataChanged signal each time a property informs us of an update.
+  All of these signals, from every element, are routed through one
+  \c SignalDispatcher owned by this model. The dispatcher hands us back the
+  sending object and the property index, which we resolve to a row and role.
+  The destroyed signal uses the id following the last property.
   
   \list
   \li \a index Index of item in the model.
@@ -593,41 +1127,260 @@ void GenericListModel::connectElement(QModelIndex index)
     return;
 
   // If object is deleted externally we remove from the model.
-  connect(object, &QObject::destroyed, this,
-    [this, pIndex = QPersistentModelIndex(index)]
+  static const int destroyedIndex = QMetaMethod::fromSignal(&QObject::destroyed).methodIndex();
+  m_dispatcher->connectSignal(object, destroyedIndex, destroyedId());
+
+  // Connect to each property notifySignal and hook up to our dataChanged signal
+  // via the dispatcher. The dispatcher id is the property index relative to
+  // the property offset.
+  const int count = m_typeInfo->propertyCount();
+  for (int i = 0; i < count; ++i)
+  {
+    const int signalIndex = m_typeInfo->notifySignalIndex(i);
+    if (signalIndex >= 0)
+      m_dispatcher->connectSignal(object, signalIndex, i);
+  }
+}
+
+/*!
+  \internal
+
+  \brief Called by the dispatcher when a property notify signal fires on
+  \a element.
+
+  Emits \l dataChanged for the row of \a element with the role mapped to
+  the property at relative index \a propertyIndex. Notifications from objects
+  no longer held by this model are ignored.
+ */
+void GenericListModel::elementPropertyChanged(QObject* element, int propertyIndex)
+{
+  if (!element)
+    return;
+
+  const int row = rowOf(element);
+  if (row < 0)
+    return;
+
+  const int role = propertyIndex + Qt::UserRole + 1;
+  if (m_batchingEnabled)
+  {
+    m_pendingChanges.append(std::make_pair(row, role));
+    if (!m_flushScheduled)
     {
-      if (!pIndex.isValid())
-        return;
+      m_flushScheduled = true;
+      QTimer::singleShot(0, this, &GenericListModel::flush);
+    }
+    return;
+  }
+
+  // Fold the display and edit roles into the same signal when the display
+  // property changes, rather than having them emitted separately.
+  const auto i = index(row);
+  if (role == displayRole())
+    emit dataChanged(i, i, { Qt::UserRole, role, Qt::DisplayRole, Qt::EditRole });
+  else
+    emit dataChanged(i, i, { Qt::UserRole, role });
+}
 
-      const auto row = pIndex.row();
-      
-      if (row < 0 || row >= m_objects.size())
-        return;
+/*!
+  \internal
+
+  \brief Called by the dispatcher when \a element is being destroyed
+  elsewhere. Empties the row holding \a element, if any, and schedules its
+  removal.
+
+  Rows are removed from the event loop so that objects destroyed together,
+  such as the children of a deleted parent, share one removal pass and one
+  renumbering of the row index.
+ */
+void GenericListModel::elementDestroyed(QObject* element)
+{
+  const int row = rowOf(element);
+  if (row < 0)
+    return;
 
-      m_objects[row] = nullptr; // Prevents double delete.
-      removeRow(row, pIndex.parent());
+  m_rows.remove(element);
+  m_objects[row] = nullptr; // Prevents double delete.
+  if (!m_removalScheduled)
+  {
+    m_removalScheduled = true;
+    QTimer::singleShot(0, this, &GenericListModel::removeDestroyedRows);
+  }
+}
+
+/*!
+  \internal
+  \brief Removes the rows emptied by \l elementDestroyed, one contiguous run
+  at a time, starting from the end of the list.
+ */
+void GenericListModel::removeDestroyedRows()
+{
+  m_removalScheduled = false;
+  flush();
+
+  int last = m_objects.size() - 1;
+  while (last >= 0)
+  {
+    if (m_objects.at(last))
+    {
+      --last;
+      continue;
     }
-  );
 
-  // Connect to each property notifySignal and hook up to our dataChanged signal
-  // using MetaElement objects as drop-in replacements for lambdas.
-  const auto offset = m_elementType->propertyOffset();
-  for (int i = offset; i < m_elementType->propertyCount(); ++i)
+    int first = last;
+    while (first > 0 && !m_objects.at(first - 1))
+      --first;
+
+    beginRemoveRows(QModelIndex(), first, last);
+    takeRows(first, last - first + 1);
+    endRemoveRows();
+    last = first - 1;
+  }
+}
+
+/*!
+  \internal
+  \brief Returns the dispatcher id used for the destroyed signal, which
+  follows the ids of the properties of the element type.
+ */
+int GenericListModel::destroyedId() const
+{
+  return m_typeInfo ? m_typeInfo->propertyCount() : 0;
+}
+
+/*!
+  \internal
+  \brief Returns the user role of the property exposed as \c Qt::DisplayRole,
+  or -1 if no display property has been set.
+ */
+int GenericListModel::displayRole() const
+{
+  return m_displayRole;
+}
+
+/*!
+  \brief Sets whether property change notifications are batched to
+  \a enabled.
+
+  When enabled, property notify signals do not immediately emit
+  \l dataChanged. Instead the changed rows and roles are recorded, and on the
+  next turn of the event loop (or when \l flush is called) contiguous rows are
+  merged into ranges and one \l dataChanged is emitted per range with the
+  union of the changed roles.
+
+  Disabling batching flushes any pending changes.
+
+  Batching is disabled by default.
+ */
+void GenericListModel::setBatchingEnabled(bool enabled)
+{
+  if (m_batchingEnabled == enabled)
+    return;
+
+  m_batchingEnabled = enabled;
+
+  if (!m_batchingEnabled)
+    flush();
+}
+
+/*!
+  \brief Returns whether property change notifications are batched.
+  \sa setBatchingEnabled
+ */
+bool GenericListModel::isBatchingEnabled() const
+{
+  return m_batchingEnabled;
+}
+
+/*!
+  \brief Emits \l dataChanged for all property changes collected while
+  batching.
+
+  Rows are sorted and merged into contiguous ranges. Each range is emitted as
+  a single \l dataChanged signal carrying the union of the roles that
+  changed within it.
+
+  The model flushes automatically before rows are inserted or removed ahead of
+  the end of the list, so pending rows always refer to the current contents
+  of the list.
+
+  \sa setBatchingEnabled
+ */
+void GenericListModel::flush()
+{
+  m_flushScheduled = false;
+  if (m_pendingChanges.isEmpty())
+    return;
+
+  auto changes = std::move(m_pendingChanges);
+  m_pendingChanges.clear();
+
+  std::sort(changes.begin(), changes.end());
+  changes.erase(std::unique(changes.begin(), changes.end()), changes.end());
+
+  const int display = displayRole();
+  const int size = m_objects.size();
+  auto it = changes.cbegin();
+  while (it != changes.cend())
+  {
+    const int first = it->first;
+    int last = first;
+    QVector<int> roles { Qt::UserRole };
+    for (; it != changes.cend() && it->first <= last + 1; ++it)
+    {
+      last = it->first;
+      if (!roles.contains(it->second))
+        roles.append(it->second);
+    }
+
+    if (first >= size)
+      break;
+
+    last = std::min(last, size - 1);
+
+    if (display >= 0 && roles.contains(display))
+      roles << Qt::DisplayRole << Qt::EditRole;
+
+    emit dataChanged(index(first), index(last), roles);
+  }
+}
+
+/*!
+  \internal
+
+  \brief Returns the row of \a element in this model, or -1 if the model does
+  not hold \a element.
+
+  Row lookups are served from a hash of object to row. Removed objects are
+  erased from the hash as they leave the list, and the rows at and after an
+  insertion or removal are marked stale rather than renumbered. A lookup that
+  lands in the stale tail renumbers that tail, which is linear in its length,
+  so lookups are constant time only when amortised over a batch of changes.
+  Consecutive changes share a single renumbering pass, and objects destroyed
+  elsewhere are removed together by \l removeDestroyedRows for the same
+  reason.
+ */
+int GenericListModel::rowOf(const QObject* element) const
+{
+  if (!element)
+    return -1;
+
+  const auto it = m_rows.constFind(element);
+  if (it != m_rows.cend() && it.value() < m_indexedRows)
+    return it.value();
+
+  const int size = m_objects.size();
+  if (m_indexedRows < size)
   {
-    auto property = m_elementType->property(i);
-    if (property.hasNotifySignal())
+    m_rows.reserve(size);
+    for (int i = m_indexedRows; i < size; ++i)
     {
-      auto element = new MetaElement(
-        index,
-        i - offset + Qt::UserRole +1,
-        object,
-        this);
-
-      // Signal to signal connection.
-      connect(object, property.notifySignal(),
-              element, QMetaMethod::fromSignal(&MetaElement::propertyChanged));
+      if (auto o = m_objects.at(i))
+        m_rows.insert(o, i);
     }
+    m_indexedRows = size;
   }
+  return m_rows.value(element, -1);
 }
 
 /*!
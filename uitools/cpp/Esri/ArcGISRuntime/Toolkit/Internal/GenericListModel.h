@@ -17,9 +17,13 @@
 #define ESRI_ARCGISRUNTIME_TOOLKIT_INTERNAL_GENERICLISTMODEL_H
 
 #include <QAbstractListModel>
+#include <QHash>
 #include <QMetaObject>
+#include <QMetaProperty>
+#include <QVector>
 
 #include <type_traits>
+#include <utility>
 
 namespace Esri
 {
@@ -28,6 +32,9 @@ namespace ArcGISRuntime
 namespace Toolkit
 {
 
+class ElementTypeInfo;
+class SignalDispatcher;
+
 class GenericListModel : public QAbstractListModel
 {
   Q_OBJECT
@@ -44,6 +51,8 @@ public:
 
   const QMetaObject* elementType() const;
 
+  const ElementTypeInfo* elementTypeInfo() const;
+
   void setDisplayPropertyName(const QString& propertyName);
 
   QString displayPropertyName();
@@ -67,6 +76,18 @@ public:
 
   Q_INVOKABLE bool append(QObject* object);
 
+  Q_INVOKABLE bool setObjects(QList<QObject*> objects);
+
+  void setRecyclingCapacity(int capacity);
+
+  int recyclingCapacity() const;
+
+  void setBatchingEnabled(bool enabled);
+
+  bool isBatchingEnabled() const;
+
+  void flush();
+
   template <typename T>  
   T* element(const QModelIndex& index) const
   {
@@ -78,14 +99,48 @@ signals:
   void countChanged();
 
 private:
+  QObject* createElement();
+
+  void releaseElement(QObject* o);
+
+  QList<QObject*> takeRows(int row, int count);
+
+  void insertObjects(int row, const QList<QObject*>& objects);
+
+  void connectElements(int first, int last);
+
   void connectElement(QModelIndex index);
 
+  void elementPropertyChanged(QObject* element, int propertyIndex);
+
+  void elementDestroyed(QObject* element);
+
+  void removeDestroyedRows();
+
+  int destroyedId() const;
+
+  int displayRole() const;
+
+  int rowOf(const QObject* element) const;
+
   int count() const;
 
 private:
-  int m_displayPropIndex = -1;
+  int m_displayRole = -1;
+  QMetaProperty m_displayProperty;
   const QMetaObject* m_elementType = nullptr;
+  const ElementTypeInfo* m_typeInfo = nullptr;
   QList<QObject*> m_objects;
+  SignalDispatcher* m_dispatcher = nullptr;
+  mutable QHash<const QObject*, int> m_rows;
+  mutable int m_indexedRows = 0;
+  bool m_batchingEnabled = false;
+  bool m_flushScheduled = false;
+  bool m_removalScheduled = false;
+  QVector<std::pair<int, int>> m_pendingChanges;
+  int m_poolCapacity = 0;
+  QList<QObject*> m_pool;
+  QObject* m_prototype = nullptr;
 };
 
 } // Toolkit
@@ -15,9 +15,10 @@
  ******************************************************************************/
 #include "GenericTableProxyModel.h"
 
+#include "ElementTypeInfo.h"
 #include "GenericListModel.h"
 
-#include <QMetaProperty>
+#include <algorithm>
 
 namespace Esri
 {
@@ -26,33 +27,6 @@ namespace ArcGISRuntime
 namespace Toolkit
 {
 
-namespace
-{
-
-/*
-  \internal
-  \brief Takes a string and transforms it into title-case.
-  
-  This is for property headers.
-  
-  \list
-  \li \a string String to turn into title case.
-  \endlist
-
-  Returns a title-case string.
- */
-QString toTitleCase(const QString& string)
-{
-  QStringList parts = string.split(' ', Qt::SkipEmptyParts);
-  for (auto& part: parts)
-  {
-    part.replace(0, 1, part.at(0).toUpper());
-  }
-  return parts.join(" ");
-}
-
-}
-
 /*!
  \internal 
  \inmodule EsriArcGISRuntimeToolkit
@@ -127,13 +101,7 @@ void GenericTableProxyModel::setSourceModel(GenericListModel* listModel)
     connect(m_sourceModel, &GenericListModel::modelAboutToBeReset, this, &GenericTableProxyModel::modelAboutToBeReset);
     connect(m_sourceModel, &GenericListModel::modelReset, this, &GenericTableProxyModel::modelReset);
 
-    connect(m_sourceModel, &GenericListModel::dataChanged, this,
-            [this](const QModelIndex& topLeft, const QModelIndex& bottomRight, const QVector<int>& /*roles*/)
-    {
-      emit dataChanged(index(topLeft.row(), 0),
-                       index(bottomRight.row(), columnCount() - 1),
-                       { Qt::DisplayRole, Qt::EditRole});
-    });
+    connect(m_sourceModel, &GenericListModel::dataChanged, this, &GenericTableProxyModel::sourceDataChanged);
 
     connect(m_sourceModel, &GenericListModel::rowsAboutToBeInserted, this, &GenericTableProxyModel::rowsAboutToBeInserted);
     connect(m_sourceModel, &GenericListModel::rowsAboutToBeMoved, this, &GenericTableProxyModel::rowsAboutToBeMoved);
@@ -145,6 +113,78 @@ void GenericTableProxyModel::setSourceModel(GenericListModel* listModel)
   endResetModel();
 }
 
+/*!
+  \internal
+
+  \brief Forwards a \c dataChanged signal from the source list as
+  \c dataChanged signals on only the columns that changed.
+
+  Each property role in \a roles maps to the column of that property, and
+  \c Qt::DisplayRole and \c Qt::EditRole map to the column of the source's
+  display property. \c Qt::UserRole is ignored. If no column can be
+  determined from \a roles, for example because it is empty, every column is
+  considered changed.
+
+  The columns are merged into contiguous runs, and one \c dataChanged is
+  emitted per run spanning the rows \a topLeft to \a bottomRight. Contiguous
+  rows are merged by the source model when it batches changes.
+
+  \sa Esri::ArcGISRuntime::Toolkit::GenericListModel::setBatchingEnabled
+ */
+void GenericTableProxyModel::sourceDataChanged(const QModelIndex& topLeft, const QModelIndex& bottomRight,
+                                               const QVector<int>& roles)
+{
+  const int columns = columnCount();
+  if (columns < 1)
+    return;
+
+  const int top = topLeft.row();
+  const int bottom = bottomRight.row();
+
+  QVector<int> changed;
+  changed.reserve(roles.size());
+  int displayColumn = -2; // Resolved on first use.
+  for (const int role : roles)
+  {
+    if (role == Qt::DisplayRole || role == Qt::EditRole)
+    {
+      if (displayColumn == -2)
+      {
+        displayColumn = m_sourceModel->elementTypeInfo()->indexOfProperty(
+              m_sourceModel->displayPropertyName().toLatin1());
+      }
+      if (displayColumn >= 0)
+        changed.append(displayColumn);
+    }
+    else if (role > Qt::UserRole)
+    {
+      const int column = role - (Qt::UserRole + 1);
+      if (column < columns)
+        changed.append(column);
+    }
+  }
+
+  if (changed.isEmpty())
+  {
+    emit dataChanged(index(top, 0), index(bottom, columns - 1), { Qt::DisplayRole, Qt::EditRole });
+    return;
+  }
+
+  std::sort(changed.begin(), changed.end());
+  changed.erase(std::unique(changed.begin(), changed.end()), changed.end());
+
+  auto it = changed.cbegin();
+  while (it != changed.cend())
+  {
+    const int first = *it;
+    int last = first;
+    for (++it; it != changed.cend() && *it == last + 1; ++it)
+      last = *it;
+
+    emit dataChanged(index(top, first), index(bottom, last), { Qt::DisplayRole, Qt::EditRole });
+  }
+}
+
 /*!
   \brief Returns the number of rows in the table, and number of objects in the 
   list.
@@ -176,7 +216,9 @@ int GenericTableProxyModel::columnCount(const QModelIndex& parent) const
 {
   if (parent.isValid())
     return 0;
-  return m_sourceModel ? m_sourceModel->roleNames().size() - 1: 0;
+
+  const auto typeInfo = m_sourceModel ? m_sourceModel->elementTypeInfo() : nullptr;
+  return typeInfo ? typeInfo->propertyCount() : 0;
 }
 
 /*!
@@ -264,13 +306,14 @@ Qt::ItemFlags GenericTableProxyModel::flags(const QModelIndex &index) const
   if (!m_sourceModel)
     return Qt::NoItemFlags;
 
-  auto metaObject = m_sourceModel->elementType();
-  if (!metaObject)
+  auto typeInfo = m_sourceModel->elementTypeInfo();
+  if (!typeInfo)
     return Qt::NoItemFlags;
 
   auto flags = QAbstractTableModel::flags(index);
-  auto property = metaObject->property(index.column() + metaObject->propertyOffset());
-  flags.setFlag(Qt::ItemIsEditable, property.isWritable());
+  const int column = index.column();
+  flags.setFlag(Qt::ItemIsEditable,
+                column >= 0 && column < typeInfo->propertyCount() && typeInfo->isWritable(column));
   return flags;
 }
 
@@ -297,10 +340,9 @@ QVariant GenericTableProxyModel::headerData(int section, Qt::Orientation orienta
 if (Qt::Orientation::Vertical == orientation)
   return section + 1;
 
-  const auto roles = m_sourceModel ? m_sourceModel->roleNames() : QHash<int, QByteArray>();
-  auto it = roles.find(section + Qt::UserRole + 1);
-  if (it != roles.end())
-    return toTitleCase(QString(it.value()));
+  const auto typeInfo = m_sourceModel ? m_sourceModel->elementTypeInfo() : nullptr;
+  if (typeInfo && section >= 0 && section < typeInfo->propertyCount())
+    return typeInfo->header(section);
   else
     return "";
 }
@@ -63,6 +63,10 @@ public:
 
   void setSourceModel(GenericListModel* listModel);
 
+private:
+  void sourceDataChanged(const QModelIndex& topLeft, const QModelIndex& bottomRight,
+                         const QVector<int>& roles);
+
 private:
   GenericListModel* m_sourceModel = nullptr;
 };
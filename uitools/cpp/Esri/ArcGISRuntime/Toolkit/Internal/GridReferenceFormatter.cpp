@@ -0,0 +1,426 @@
+/*******************************************************************************
+ *  Copyright 2012-2020 Esri
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+#include "GridReferenceFormatter.h"
+
+// std headers
+#include <algorithm>
+#include <cmath>
+
+namespace Esri
+{
+namespace ArcGISRuntime
+{
+namespace Toolkit
+{
+
+namespace
+{
+
+constexpr double PI = 3.14159265358979323846;
+constexpr double DEGREES_TO_RADIANS = PI / 180.0;
+
+// WGS84 ellipsoid and UTM projection constants.
+constexpr double SEMI_MAJOR_AXIS = 6378137.0;
+constexpr double FLATTENING = 1.0 / 298.257223563;
+constexpr double SCALE_FACTOR = 0.9996;
+constexpr double FALSE_EASTING = 500000.0;
+constexpr double FALSE_NORTHING_SOUTH = 10000000.0;
+
+// Digits of an MGRS or USNG reference past which the projection error may
+// show, and formatting is left to the CoordinateFormatter.
+constexpr int MAX_PRECISION = 8;
+
+constexpr int BLOCK_SIZE = 256;
+constexpr int BUFFER_SIZE = 64;
+
+constexpr char BAND_LETTERS[] = "CDEFGHJKLMNPQRSTUVWX";
+constexpr char COLUMN_LETTERS[] = "ABCDEFGHJKLMNPQRSTUVWXYZ";
+constexpr char ROW_LETTERS[] = "ABCDEFGHJKLMNPQRSTUV";
+
+struct Tables
+{
+  // Band index for each whole degree of latitude from -80 to 84.
+  signed char bands[164];
+
+  // UTM zone for each band and whole degree of longitude from -180 to 180,
+  // including the Norway and Svalbard exceptions.
+  unsigned char zones[20][360];
+
+  // 100km column letter for each zone set and column from 1 to 8.
+  char columns[3][8];
+
+  // 100km row letter for each lettering scheme, zone parity and row.
+  char rows[2][2][20];
+
+  Tables()
+  {
+    for (int i = 0; i < 164; ++i)
+      bands[i] = static_cast<signed char>(std::min(19, i / 8));
+
+    for (int band = 0; band < 20; ++band)
+    {
+      for (int i = 0; i < 360; ++i)
+      {
+        int zone = i / 6 + 1;
+        const int longitude = i - 180;
+        if (BAND_LETTERS[band] == 'V' && longitude >= 3 && longitude < 12)
+        {
+          zone = 32;
+        }
+        else if (BAND_LETTERS[band] == 'X' && longitude >= 0 && longitude < 42)
+        {
+          if (longitude < 9)
+            zone = 31;
+          else if (longitude < 21)
+            zone = 33;
+          else if (longitude < 33)
+            zone = 35;
+          else
+            zone = 37;
+        }
+        zones[band][i] = static_cast<unsigned char>(zone);
+      }
+    }
+
+    for (int set = 0; set < 3; ++set)
+    {
+      for (int column = 0; column < 8; ++column)
+        columns[set][column] = COLUMN_LETTERS[set * 8 + column];
+    }
+
+    for (int old = 0; old < 2; ++old)
+    {
+      for (int even = 0; even < 2; ++even)
+      {
+        const int offset = (old ? 10 : 0) + (even ? 5 : 0);
+        for (int row = 0; row < 20; ++row)
+          rows[old][even][row] = ROW_LETTERS[(row + offset) % 20];
+      }
+    }
+  }
+};
+
+const Tables& tables()
+{
+  static const Tables t;
+  return t;
+}
+
+// Coefficients of the Krüger series for the transverse Mercator projection,
+// to sixth order in the third flattening.
+struct Series
+{
+  double rectifyingRadius;
+  double eccentricity;
+  double alpha[6];
+
+  Series()
+  {
+    const double n = FLATTENING / (2.0 - FLATTENING);
+    const double n2 = n * n;
+    const double n3 = n2 * n;
+    const double n4 = n3 * n;
+    const double n5 = n4 * n;
+    const double n6 = n5 * n;
+
+    rectifyingRadius = SEMI_MAJOR_AXIS / (1.0 + n) * (1.0 + n2 / 4.0 + n4 / 64.0 + n6 / 256.0);
+    eccentricity = std::sqrt(FLATTENING * (2.0 - FLATTENING));
+
+    alpha[0] = n / 2.0 - 2.0 / 3.0 * n2 + 5.0 / 16.0 * n3 + 41.0 / 180.0 * n4
+             - 127.0 / 288.0 * n5 + 7891.0 / 37800.0 * n6;
+    alpha[1] = 13.0 / 48.0 * n2 - 3.0 / 5.0 * n3 + 557.0 / 1440.0 * n4
+             + 281.0 / 630.0 * n5 - 1983433.0 / 1935360.0 * n6;
+    alpha[2] = 61.0 / 240.0 * n3 - 103.0 / 140.0 * n4 + 15061.0 / 26880.0 * n5
+             + 167603.0 / 181440.0 * n6;
+    alpha[3] = 49561.0 / 161280.0 * n4 - 179.0 / 168.0 * n5 + 6601661.0 / 7257600.0 * n6;
+    alpha[4] = 34729.0 / 80640.0 * n5 - 3418889.0 / 1995840.0 * n6;
+    alpha[5] = 212378941.0 / 319334400.0 * n6;
+  }
+};
+
+const Series& series()
+{
+  static const Series s;
+  return s;
+}
+
+char* writeDigits(char* p, quint64 value, int width)
+{
+  char digits[20];
+  int n = 0;
+  do
+  {
+    digits[n++] = static_cast<char>('0' + value % 10);
+    value /= 10;
+  } while (value != 0);
+
+  for (int i = n; i < width; ++i)
+    *p++ = '0';
+
+  while (n > 0)
+    *p++ = digits[--n];
+
+  return p;
+}
+
+}
+
+/*!
+  \internal
+  \inmodule EsriArcGISRuntimeToolkit
+  \class Esri::ArcGISRuntime::Toolkit::GridReferenceFormatter
+
+  \brief Formats WGS84 latitude and longitude pairs as UTM, MGRS or USNG grid
+  references without calling into the \c CoordinateFormatter.
+
+  Zones, latitude bands and 100km square letters come from lookup tables
+  built once per process. Points are projected with the sixth-order Krüger
+  series for the transverse Mercator projection, which is accurate to a few
+  nanometres within a zone. The batch entry point projects a block of points
+  in straight-line loops before writing any text.
+
+  Only the area covered by UTM is handled. Polar points, which use UPS, and
+  points on the antimeridian, whose zone depends on the MGRS mode, are not
+  handled.
+
+  The output must match the \c CoordinateFormatter exactly. This is checked
+  bit for bit by the CoordinateConversion tests, over a corpus covering zone
+  and band edges, the Norway and Svalbard zone exceptions, band X and the
+  wrap of the 100km square letters.
+
+  \sa Esri::ArcGISRuntime::Toolkit::CoordinateConversionOption
+ */
+
+/*!
+  \brief Returns a formatter for UTM references with the given \a mode,
+  separating the parts with spaces if \a addSpaces is \c true.
+ */
+GridReferenceFormatter GridReferenceFormatter::utm(UtmConversionMode mode, bool addSpaces)
+{
+  GridReferenceFormatter formatter;
+  formatter.m_kind = Kind::Utm;
+  formatter.m_utmMode = mode;
+  formatter.m_addSpaces = addSpaces;
+  formatter.m_valid = mode == UtmConversionMode::LatitudeBandIndicators ||
+                      mode == UtmConversionMode::NorthSouthIndicators;
+  return formatter;
+}
+
+/*!
+  \brief Returns a formatter for MGRS references with the given \a mode and
+  \a precision digits for each of the easting and northing, separating the
+  parts with spaces if \a addSpaces is \c true.
+ */
+GridReferenceFormatter GridReferenceFormatter::mgrs(MgrsConversionMode mode, int precision, bool addSpaces)
+{
+  GridReferenceFormatter formatter;
+  formatter.m_kind = Kind::Mgrs;
+  formatter.m_mgrsMode = mode;
+  formatter.m_precision = precision;
+  formatter.m_addSpaces = addSpaces;
+  formatter.m_oldLettering = mode == MgrsConversionMode::Old180InZone01 ||
+                             mode == MgrsConversionMode::Old180InZone60;
+  formatter.m_valid = precision >= 0 && precision <= MAX_PRECISION &&
+                      (mode == MgrsConversionMode::Automatic ||
+                       mode == MgrsConversionMode::New180InZone01 ||
+                       mode == MgrsConversionMode::New180InZone60 ||
+                       mode == MgrsConversionMode::Old180InZone01 ||
+                       mode == MgrsConversionMode::Old180InZone60);
+  return formatter;
+}
+
+/*!
+  \brief Returns a formatter for USNG references with \a precision digits
+  for each of the easting and northing, separating the parts with spaces if
+  \a addSpaces is \c true.
+ */
+GridReferenceFormatter GridReferenceFormatter::usng(int precision, bool addSpaces)
+{
+  GridReferenceFormatter formatter;
+  formatter.m_kind = Kind::Usng;
+  formatter.m_precision = precision;
+  formatter.m_addSpaces = addSpaces;
+  formatter.m_valid = precision >= 0 && precision <= MAX_PRECISION;
+  return formatter;
+}
+
+/*!
+  \brief Returns whether this formatter handles its parameters. Unknown
+  modes and precisions of more than eight digits are left to the
+  \c CoordinateFormatter.
+ */
+bool GridReferenceFormatter::isSupported() const
+{
+  return m_valid;
+}
+
+/*!
+  \brief Returns whether \a latitude and \a longitude, in WGS84 degrees,
+  are in the area covered by UTM and away from the antimeridian.
+
+  Callers check the spatial reference of the point themselves, once per
+  batch where they can.
+ */
+bool GridReferenceFormatter::canFormat(double latitude, double longitude)
+{
+  return std::isfinite(latitude) && std::isfinite(longitude) &&
+         latitude >= -80.0 && latitude < 84.0 && longitude > -180.0 && longitude < 180.0;
+}
+
+/*!
+  \brief Returns the grid reference of \a latitude and \a longitude, in
+  degrees.
+ */
+QString GridReferenceFormatter::format(double latitude, double longitude) const
+{
+  Projected projected;
+  project(&latitude, &longitude, 1, &projected);
+
+  char buffer[BUFFER_SIZE];
+  const int size = write(buffer, projected, latitude);
+  return QString::fromLatin1(buffer, size);
+}
+
+/*!
+  \brief Writes the grid references of \a count points to \a out, where the
+  coordinates of point \c i are \c{latitudes[i]} and \c{longitudes[i]} in
+  degrees.
+ */
+void GridReferenceFormatter::format(const double* latitudes, const double* longitudes,
+                                    int count, QString* out) const
+{
+  Projected projected[BLOCK_SIZE];
+  char buffer[BUFFER_SIZE];
+  for (int first = 0; first < count; first += BLOCK_SIZE)
+  {
+    const int n = std::min(BLOCK_SIZE, count - first);
+    project(latitudes + first, longitudes + first, n, projected);
+
+    for (int i = 0; i < n; ++i)
+    {
+      const int size = write(buffer, projected[i], latitudes[first + i]);
+      out[first + i] = QString::fromLatin1(buffer, size);
+    }
+  }
+}
+
+/*!
+  \brief Finds the zone and band of \a count points, then projects them
+  into UTM coordinates in \a out.
+
+  Points must be within the area accepted by \l canFormat.
+ */
+void GridReferenceFormatter::project(const double* latitudes, const double* longitudes,
+                                     int count, Projected* out)
+{
+  const auto& t = tables();
+  const auto& s = series();
+
+  for (int i = 0; i < count; ++i)
+  {
+    const int latitudeIndex = std::min(163, std::max(0, static_cast<int>(std::floor(latitudes[i] + 80.0))));
+    const int longitudeIndex = std::min(359, std::max(0, static_cast<int>(std::floor(longitudes[i] + 180.0))));
+    out[i].band = t.bands[latitudeIndex];
+    out[i].zone = t.zones[out[i].band][longitudeIndex];
+  }
+
+  for (int i = 0; i < count; ++i)
+  {
+    const double centralMeridian = out[i].zone * 6.0 - 183.0;
+    const double phi = latitudes[i] * DEGREES_TO_RADIANS;
+    const double lambda = (longitudes[i] - centralMeridian) * DEGREES_TO_RADIANS;
+
+    const double sinPhi = std::sin(phi);
+    const double tau = std::sinh(std::atanh(sinPhi) - s.eccentricity * std::atanh(s.eccentricity * sinPhi));
+    const double xiPrime = std::atan2(tau, std::cos(lambda));
+    const double etaPrime = std::atanh(std::sin(lambda) / std::sqrt(1.0 + tau * tau));
+
+    double xi = xiPrime;
+    double eta = etaPrime;
+    for (int j = 0; j < 6; ++j)
+    {
+      const double k = 2.0 * (j + 1);
+      xi += s.alpha[j] * std::sin(k * xiPrime) * std::cosh(k * etaPrime);
+      eta += s.alpha[j] * std::cos(k * xiPrime) * std::sinh(k * etaPrime);
+    }
+
+    out[i].easting = FALSE_EASTING + SCALE_FACTOR * s.rectifyingRadius * eta;
+    out[i].northing = SCALE_FACTOR * s.rectifyingRadius * xi;
+    if (latitudes[i] < 0.0)
+      out[i].northing += FALSE_NORTHING_SOUTH;
+  }
+}
+
+/*!
+  \internal
+  \brief Writes the grid reference of \a projected, at \a latitude, to
+  \a buffer and returns the number of characters written.
+ */
+int GridReferenceFormatter::write(char* buffer, const Projected& projected, double latitude) const
+{
+  char* p = buffer;
+  if (m_kind == Kind::Utm)
+  {
+    p = writeDigits(p, projected.zone, 1);
+    if (m_utmMode == UtmConversionMode::NorthSouthIndicators)
+      *p++ = latitude < 0.0 ? 'S' : 'N';
+    else
+      *p++ = BAND_LETTERS[projected.band];
+
+    if (m_addSpaces)
+      *p++ = ' ';
+
+    p = writeDigits(p, static_cast<quint64>(std::floor(projected.easting + 0.5)), 1);
+    if (m_addSpaces)
+      *p++ = ' ';
+
+    p = writeDigits(p, static_cast<quint64>(std::floor(projected.northing + 0.5)), 1);
+    return static_cast<int>(p - buffer);
+  }
+
+  const auto& t = tables();
+  const int column = static_cast<int>(std::floor(projected.easting / 100000.0));
+  const int row = static_cast<int>(std::floor(projected.northing / 100000.0)) % 20;
+  const double easting = projected.easting - column * 100000.0;
+  const double northing = std::fmod(projected.northing, 100000.0);
+
+  p = writeDigits(p, projected.zone, 2);
+  *p++ = BAND_LETTERS[projected.band];
+  if (m_addSpaces)
+    *p++ = ' ';
+
+  *p++ = t.columns[(projected.zone - 1) % 3][std::min(7, std::max(0, column - 1))];
+  *p++ = t.rows[m_oldLettering ? 1 : 0][projected.zone % 2 == 0 ? 1 : 0][row];
+
+  if (m_precision > 0)
+  {
+    // Grid references truncate rather than round.
+    const double scale = std::pow(10.0, m_precision - 5);
+    if (m_addSpaces)
+      *p++ = ' ';
+
+    p = writeDigits(p, static_cast<quint64>(std::floor(easting * scale)), m_precision);
+    if (m_addSpaces)
+      *p++ = ' ';
+
+    p = writeDigits(p, static_cast<quint64>(std::floor(northing * scale)), m_precision);
+  }
+  return static_cast<int>(p - buffer);
+}
+
+} // Toolkit
+} // ArcGISRuntime
+} // Esri
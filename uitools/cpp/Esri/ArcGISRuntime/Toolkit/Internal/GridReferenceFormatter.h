@@ -0,0 +1,85 @@
+/*******************************************************************************
+ *  Copyright 2012-2020 Esri
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+#ifndef ESRI_ARCGISRUNTIME_TOOLKIT_INTERNAL_GRIDREFERENCEFORMATTER_H
+#define ESRI_ARCGISRUNTIME_TOOLKIT_INTERNAL_GRIDREFERENCEFORMATTER_H
+
+// Qt headers
+#include <QString>
+
+// ArcGISRuntime headers
+#include <GeometryTypes.h>
+
+namespace Esri
+{
+namespace ArcGISRuntime
+{
+namespace Toolkit
+{
+
+class GridReferenceFormatter
+{
+public:
+  static GridReferenceFormatter utm(UtmConversionMode mode, bool addSpaces);
+
+  static GridReferenceFormatter mgrs(MgrsConversionMode mode, int precision, bool addSpaces);
+
+  static GridReferenceFormatter usng(int precision, bool addSpaces);
+
+  bool isSupported() const;
+
+  static bool canFormat(double latitude, double longitude);
+
+  QString format(double latitude, double longitude) const;
+
+  void format(const double* latitudes, const double* longitudes, int count, QString* out) const;
+
+  struct Projected
+  {
+    double easting = 0.0;
+    double northing = 0.0;
+    int zone = 0;
+    int band = 0;
+  };
+
+  static void project(const double* latitudes, const double* longitudes, int count, Projected* out);
+
+private:
+  enum class Kind
+  {
+    Utm,
+    Mgrs,
+    Usng
+  };
+
+  GridReferenceFormatter() = default;
+
+  int write(char* buffer, const Projected& projected, double latitude) const;
+
+private:
+  Kind m_kind = Kind::Utm;
+  UtmConversionMode m_utmMode = UtmConversionMode::LatitudeBandIndicators;
+  MgrsConversionMode m_mgrsMode = MgrsConversionMode::Automatic;
+  int m_precision = 0;
+  bool m_addSpaces = false;
+  bool m_oldLettering = false;
+  bool m_valid = false;
+};
+
+} // Toolkit
+} // ArcGISRuntime
+} // Esri
+
+#endif // ESRI_ARCGISRUNTIME_TOOLKIT_INTERNAL_GRIDREFERENCEFORMATTER_H
@@ -0,0 +1,264 @@
+/*******************************************************************************
+ *  Copyright 2012-2020 Esri
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+#include "LatitudeLongitudeFormatter.h"
+
+// std headers
+#include <algorithm>
+#include <cmath>
+
+namespace Esri
+{
+namespace ArcGISRuntime
+{
+namespace Toolkit
+{
+
+namespace
+{
+
+// Beyond this many decimal places the scaled coordinates are no longer exact
+// in a double, and formatting is left to the CoordinateFormatter.
+constexpr int MAX_DECIMAL_PLACES = 8;
+
+// Points are scaled and rounded a block at a time before any text is written,
+// which keeps the arithmetic in tight loops the compiler can vectorize.
+constexpr int BLOCK_SIZE = 256;
+
+// Longest output is two DMS angles of 3 + 1 + 2 + 1 + 2 + 1 + 8 + 1 chars.
+constexpr int BUFFER_SIZE = 64;
+
+int formatIndex(LatitudeLongitudeFormat format)
+{
+  switch (format)
+  {
+    case LatitudeLongitudeFormat::DecimalDegrees:
+      return 0;
+    case LatitudeLongitudeFormat::DegreesDecimalMinutes:
+      return 1;
+    case LatitudeLongitudeFormat::DegreesMinutesSeconds:
+      return 2;
+    default:
+      return -1;
+  }
+}
+
+char* writeDigits(char* p, quint64 value, int width)
+{
+  char digits[20];
+  int n = 0;
+  do
+  {
+    digits[n++] = static_cast<char>('0' + value % 10);
+    value /= 10;
+  } while (value != 0);
+
+  for (int i = n; i < width; ++i)
+    *p++ = '0';
+
+  while (n > 0)
+    *p++ = digits[--n];
+
+  return p;
+}
+
+}
+
+/*!
+  \internal
+  \inmodule EsriArcGISRuntimeToolkit
+  \class Esri::ArcGISRuntime::Toolkit::LatitudeLongitudeFormatter
+
+  \brief Formats WGS84 latitude and longitude pairs as decimal degrees,
+  degrees and decimal minutes, or degrees, minutes and seconds, without
+  calling into the \c CoordinateFormatter.
+
+  Each coordinate is scaled to an integer number of the smallest printed unit
+  and rounded once, so carries from the seconds into the minutes and degrees
+  are exact. Text is written into a stack buffer; the only allocation per
+  point is the returned \c QString.
+
+  The output must match \c CoordinateFormatter::toLatitudeLongitude exactly.
+  This is checked by the CoordinateConversion tests over a dense grid of
+  points, including those whose rounding carries into the minutes and
+  degrees.
+
+  \sa Esri::ArcGISRuntime::Toolkit::CoordinateConversionOption
+ */
+
+/*!
+  \brief Constructs a formatter for \a format with \a decimalPlaces digits
+  after the decimal point of the smallest unit.
+ */
+LatitudeLongitudeFormatter::LatitudeLongitudeFormatter(LatitudeLongitudeFormat format, int decimalPlaces) :
+  m_format(format),
+  m_decimalPlaces(decimalPlaces),
+  m_formatIndex(formatIndex(format))
+{
+  if (m_decimalPlaces < 0 || m_decimalPlaces > MAX_DECIMAL_PLACES)
+  {
+    m_formatIndex = -1;
+    return;
+  }
+
+  for (int i = 0; i < m_decimalPlaces; ++i)
+    m_scale *= 10;
+
+  switch (m_formatIndex)
+  {
+    case 0:
+      m_unitsPerMinute = m_scale;
+      m_unitsPerDegree = m_scale;
+      break;
+    case 1:
+      m_unitsPerMinute = m_scale;
+      m_unitsPerDegree = 60 * m_scale;
+      break;
+    case 2:
+      m_unitsPerMinute = 60 * m_scale;
+      m_unitsPerDegree = 3600 * m_scale;
+      break;
+    default:
+      break;
+  }
+}
+
+/*!
+  \brief Returns whether this formatter handles its format and number of
+  decimal places. Formats with more than eight decimal places are left to
+  the \c CoordinateFormatter.
+ */
+bool LatitudeLongitudeFormatter::isSupported() const
+{
+  return m_formatIndex >= 0;
+}
+
+/*!
+  \brief Returns whether \a latitude and \a longitude, in WGS84 degrees,
+  are within the range this formatter can handle.
+
+  Callers check the spatial reference of the point themselves, once per
+  batch where they can.
+ */
+bool LatitudeLongitudeFormatter::canFormat(double latitude, double longitude)
+{
+  return std::isfinite(latitude) && std::isfinite(longitude) &&
+         std::abs(latitude) <= 90.0 && std::abs(longitude) <= 180.0;
+}
+
+/*!
+  \brief Returns the notation of \a latitude and \a longitude, in degrees.
+ */
+QString LatitudeLongitudeFormatter::format(double latitude, double longitude) const
+{
+  char buffer[BUFFER_SIZE];
+  const double latitudeUnits = std::floor(std::abs(latitude) * m_unitsPerDegree + 0.5);
+  const double longitudeUnits = std::floor(std::abs(longitude) * m_unitsPerDegree + 0.5);
+  const int size = write(buffer, latitudeUnits, longitudeUnits, latitude < 0.0, longitude < 0.0);
+  return QString::fromLatin1(buffer, size);
+}
+
+/*!
+  \brief Writes the notations of \a count points to \a out, where the
+  coordinates of point \c i are \c{latitudes[i]} and \c{longitudes[i]} in
+  degrees.
+ */
+void LatitudeLongitudeFormatter::format(const double* latitudes, const double* longitudes,
+                                        int count, QString* out) const
+{
+  double latitudeUnits[BLOCK_SIZE];
+  double longitudeUnits[BLOCK_SIZE];
+  char buffer[BUFFER_SIZE];
+  const double unitsPerDegree = static_cast<double>(m_unitsPerDegree);
+
+  for (int first = 0; first < count; first += BLOCK_SIZE)
+  {
+    const int n = std::min(BLOCK_SIZE, count - first);
+    const double* latitude = latitudes + first;
+    const double* longitude = longitudes + first;
+
+    for (int i = 0; i < n; ++i)
+      latitudeUnits[i] = std::floor(std::abs(latitude[i]) * unitsPerDegree + 0.5);
+
+    for (int i = 0; i < n; ++i)
+      longitudeUnits[i] = std::floor(std::abs(longitude[i]) * unitsPerDegree + 0.5);
+
+    for (int i = 0; i < n; ++i)
+    {
+      const int size = write(buffer, latitudeUnits[i], longitudeUnits[i],
+                             latitude[i] < 0.0, longitude[i] < 0.0);
+      out[first + i] = QString::fromLatin1(buffer, size);
+    }
+  }
+}
+
+/*!
+  \internal
+  \brief Writes a pair of rounded coordinates, given as a count of the
+  smallest printed unit, to \a buffer and returns the number of characters
+  written.
+
+  Coordinates which round to zero are reported as north and east.
+ */
+int LatitudeLongitudeFormatter::write(char* buffer, double latitudeUnits, double longitudeUnits,
+                                      bool south, bool west) const
+{
+  const auto latitude = static_cast<qint64>(latitudeUnits);
+  const auto longitude = static_cast<qint64>(longitudeUnits);
+
+  char* p = writeAngle(buffer, latitude, 2);
+  *p++ = (south && latitude != 0) ? 'S' : 'N';
+  *p++ = ' ';
+  p = writeAngle(p, longitude, 3);
+  *p++ = (west && longitude != 0) ? 'W' : 'E';
+  return static_cast<int>(p - buffer);
+}
+
+/*!
+  \internal
+  \brief Writes one angle of \a units smallest units to \a p, padding the
+  degrees to \a degreeWidth digits, and returns the end of the written text.
+ */
+char* LatitudeLongitudeFormatter::writeAngle(char* p, qint64 units, int degreeWidth) const
+{
+  const qint64 degrees = units / m_unitsPerDegree;
+  qint64 remainder = units % m_unitsPerDegree;
+  p = writeDigits(p, degrees, degreeWidth);
+
+  if (m_formatIndex >= 1)
+  {
+    *p++ = ' ';
+    p = writeDigits(p, remainder / m_unitsPerMinute, 2);
+    remainder %= m_unitsPerMinute;
+  }
+
+  if (m_formatIndex == 2)
+  {
+    *p++ = ' ';
+    p = writeDigits(p, remainder / m_scale, 2);
+    remainder %= m_scale;
+  }
+
+  if (m_decimalPlaces > 0)
+  {
+    *p++ = '.';
+    p = writeDigits(p, remainder, m_decimalPlaces);
+  }
+  return p;
+}
+
+} // Toolkit
+} // ArcGISRuntime
+} // Esri
@@ -0,0 +1,64 @@
+/*******************************************************************************
+ *  Copyright 2012-2020 Esri
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+#ifndef ESRI_ARCGISRUNTIME_TOOLKIT_INTERNAL_LATITUDELONGITUDEFORMATTER_H
+#define ESRI_ARCGISRUNTIME_TOOLKIT_INTERNAL_LATITUDELONGITUDEFORMATTER_H
+
+// Qt headers
+#include <QString>
+
+// ArcGISRuntime headers
+#include <GeometryTypes.h>
+
+namespace Esri
+{
+namespace ArcGISRuntime
+{
+namespace Toolkit
+{
+
+class LatitudeLongitudeFormatter
+{
+public:
+  LatitudeLongitudeFormatter(LatitudeLongitudeFormat format, int decimalPlaces);
+
+  bool isSupported() const;
+
+  static bool canFormat(double latitude, double longitude);
+
+  QString format(double latitude, double longitude) const;
+
+  void format(const double* latitudes, const double* longitudes, int count, QString* out) const;
+
+private:
+  int write(char* buffer, double latitudeUnits, double longitudeUnits,
+            bool south, bool west) const;
+
+  char* writeAngle(char* p, qint64 units, int degreeWidth) const;
+
+private:
+  LatitudeLongitudeFormat m_format;
+  int m_decimalPlaces = 0;
+  int m_formatIndex = -1;
+  qint64 m_scale = 1;
+  qint64 m_unitsPerMinute = 1;
+  qint64 m_unitsPerDegree = 1;
+};
+
+} // Toolkit
+} // ArcGISRuntime
+} // Esri
+
+#endif // ESRI_ARCGISRUNTIME_TOOLKIT_INTERNAL_LATITUDELONGITUDEFORMATTER_H
@@ -0,0 +1,209 @@
+/*******************************************************************************
+ *  Copyright 2012-2020 Esri
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+#include "NotationCache.h"
+
+// Qt headers
+#include <QMutexLocker>
+
+// std headers
+#include <algorithm>
+
+namespace Esri
+{
+namespace ArcGISRuntime
+{
+namespace Toolkit
+{
+
+/*!
+  \internal
+  \inmodule EsriArcGISRuntimeToolkit
+  \class Esri::ArcGISRuntime::Toolkit::NotationCache
+
+  \brief A bounded, least-recently-used cache of formatted notations, used by
+  CoordinateConversionOption::prettyPrint.
+
+  Each entry is keyed on the exact coordinates and spatial reference of a
+  point, together with every option parameter that affects the notation.
+  Keying on the parameters means one cache can safely be shared between an
+  option and its clones, even if they are later configured differently.
+
+  All member functions are thread-safe.
+
+  \sa Esri::ArcGISRuntime::Toolkit::CoordinateConversionOption
+ */
+
+/*!
+  \internal
+  \brief Returns whether this key and \a other describe the same conversion.
+ */
+bool NotationCache::Key::operator==(const Key& other) const
+{
+  return x == other.x &&
+         y == other.y &&
+         wkid == other.wkid &&
+         outputMode == other.outputMode &&
+         precision == other.precision &&
+         decimalPlaces == other.decimalPlaces &&
+         mgrsConversionMode == other.mgrsConversionMode &&
+         latLonFormat == other.latLonFormat &&
+         utmConversionMode == other.utmConversionMode &&
+         hasSpaces == other.hasSpaces;
+}
+
+/*!
+  \internal
+  \brief Returns the hash of \a key, salted with \a seed.
+ */
+uint qHash(const NotationCache::Key& key, uint seed)
+{
+  auto combine = [&seed](uint value)
+  {
+    seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+  };
+
+  combine(qHash(key.x));
+  combine(qHash(key.y));
+  combine(qHash(key.wkid));
+  combine(qHash(key.outputMode));
+  combine(qHash(key.precision));
+  combine(qHash(key.decimalPlaces));
+  combine(qHash(key.mgrsConversionMode));
+  combine(qHash(key.latLonFormat));
+  combine(qHash(key.utmConversionMode));
+  combine(qHash(key.hasSpaces));
+  return seed;
+}
+
+/*!
+  \brief Constructs an empty cache holding at most \a capacity notations.
+ */
+NotationCache::NotationCache(int capacity) :
+  m_capacity(std::max(0, capacity))
+{
+}
+
+/*!
+  \brief Looks up \a key and, on a hit, writes the cached notation to
+  \a notation and marks the entry as most recently used.
+
+  Returns \c true on a hit.
+ */
+bool NotationCache::lookup(const Key& key, QString& notation)
+{
+  QMutexLocker locker(&m_mutex);
+  const auto it = m_index.constFind(key);
+  if (it == m_index.cend())
+  {
+    ++m_misses;
+    return false;
+  }
+
+  ++m_hits;
+  m_entries.splice(m_entries.begin(), m_entries, it.value());
+  notation = it.value()->second;
+  return true;
+}
+
+/*!
+  \brief Stores \a notation for \a key, evicting the least recently used
+  entries if the cache is full.
+ */
+void NotationCache::insert(const Key& key, const QString& notation)
+{
+  QMutexLocker locker(&m_mutex);
+  if (m_capacity == 0)
+    return;
+
+  const auto it = m_index.find(key);
+  if (it != m_index.end())
+  {
+    // Another thread computed the same notation concurrently.
+    it.value()->second = notation;
+    m_entries.splice(m_entries.begin(), m_entries, it.value());
+    return;
+  }
+
+  m_entries.emplace_front(key, notation);
+  m_index.insert(key, m_entries.begin());
+  trim();
+}
+
+/*!
+  \brief Removes every entry. The hit and miss counters are kept.
+ */
+void NotationCache::clear()
+{
+  QMutexLocker locker(&m_mutex);
+  m_entries.clear();
+  m_index.clear();
+}
+
+/*!
+  \brief Sets the maximum number of cached notations to \a capacity. A
+  capacity of \c 0 disables caching.
+ */
+void NotationCache::setCapacity(int capacity)
+{
+  QMutexLocker locker(&m_mutex);
+  m_capacity = std::max(0, capacity);
+  trim();
+}
+
+/*!
+  \brief Returns the maximum number of cached notations.
+ */
+int NotationCache::capacity() const
+{
+  QMutexLocker locker(&m_mutex);
+  return m_capacity;
+}
+
+/*!
+  \brief Returns the number of lookups which found a cached notation.
+ */
+quint64 NotationCache::hits() const
+{
+  QMutexLocker locker(&m_mutex);
+  return m_hits;
+}
+
+/*!
+  \brief Returns the number of lookups which did not find a cached notation.
+ */
+quint64 NotationCache::misses() const
+{
+  QMutexLocker locker(&m_mutex);
+  return m_misses;
+}
+
+/*!
+  \internal
+  \brief Evicts least recently used entries until the cache fits its
+  capacity. The mutex must be held.
+ */
+void NotationCache::trim()
+{
+  while (static_cast<int>(m_entries.size()) > m_capacity)
+  {
+    m_index.remove(m_entries.back().first);
+    m_entries.pop_back();
+  }
+}
+
+} // Toolkit
+} // ArcGISRuntime
+} // Esri
@@ -0,0 +1,90 @@
+/*******************************************************************************
+ *  Copyright 2012-2020 Esri
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+#ifndef ESRI_ARCGISRUNTIME_TOOLKIT_INTERNAL_NOTATIONCACHE_H
+#define ESRI_ARCGISRUNTIME_TOOLKIT_INTERNAL_NOTATIONCACHE_H
+
+// Qt headers
+#include <QHash>
+#include <QMutex>
+#include <QString>
+
+// std headers
+#include <list>
+#include <utility>
+
+namespace Esri
+{
+namespace ArcGISRuntime
+{
+namespace Toolkit
+{
+
+class NotationCache
+{
+public:
+  struct Key
+  {
+    double x = 0.0;
+    double y = 0.0;
+    int wkid = 0;
+    int outputMode = 0;
+    int precision = 0;
+    int decimalPlaces = 0;
+    int mgrsConversionMode = 0;
+    int latLonFormat = 0;
+    int utmConversionMode = 0;
+    bool hasSpaces = false;
+
+    bool operator==(const Key& other) const;
+  };
+
+  explicit NotationCache(int capacity = 256);
+
+  bool lookup(const Key& key, QString& notation);
+
+  void insert(const Key& key, const QString& notation);
+
+  void clear();
+
+  void setCapacity(int capacity);
+
+  int capacity() const;
+
+  quint64 hits() const;
+
+  quint64 misses() const;
+
+private:
+  void trim();
+
+private:
+  using Entry = std::pair<Key, QString>;
+
+  mutable QMutex m_mutex;
+  std::list<Entry> m_entries; // Most recently used first.
+  QHash<Key, std::list<Entry>::iterator> m_index;
+  int m_capacity = 0;
+  quint64 m_hits = 0;
+  quint64 m_misses = 0;
+};
+
+uint qHash(const NotationCache::Key& key, uint seed = 0);
+
+} // Toolkit
+} // ArcGISRuntime
+} // Esri
+
+#endif // ESRI_ARCGISRUNTIME_TOOLKIT_INTERNAL_NOTATIONCACHE_H
@@ -0,0 +1,160 @@
+/*******************************************************************************
+ *  Copyright 2012-2020 Esri
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+#include "NotationClassifier.h"
+
+// Qt headers
+#include <QRegularExpression>
+
+namespace Esri
+{
+namespace ArcGISRuntime
+{
+namespace Toolkit
+{
+
+namespace
+{
+
+QRegularExpression anchored(const QString& pattern)
+{
+  QRegularExpression expression(QRegularExpression::anchoredPattern(pattern),
+                                QRegularExpression::CaseInsensitiveOption);
+  expression.optimize();
+  return expression;
+}
+
+struct Patterns
+{
+  QRegularExpression mgrs;
+  QRegularExpression ups;
+  QRegularExpression utm;
+  QRegularExpression gars;
+  QRegularExpression geoRef;
+  QRegularExpression latLon;
+
+  Patterns()
+  {
+    // Letters used by grid notations, which skip I and O.
+    const QString gridLetter = QStringLiteral("[A-HJ-NP-Z]");
+    const QString bandLetter = QStringLiteral("[C-HJ-NP-X]");
+
+    // Digits of a grid reference: none, up to 10 run together, or two
+    // groups.
+    const QString gridDigits = QStringLiteral("(?:\\d{0,10}|\\d{1,5}\\s+\\d{1,5})");
+
+    // One latitude or longitude: degrees, then optional minutes and
+    // seconds, each with an optional unit, and an optional hemisphere
+    // before or after.
+    const QString angle = QStringLiteral("[NSEW+\\-]?\\s*\\d{1,3}(?:\\.\\d+)?\\s*[°d:]?"
+                                         "(?:\\s*\\d{1,2}(?:\\.\\d+)?\\s*['′m:]?"
+                                         "(?:\\s*\\d{1,2}(?:\\.\\d+)?\\s*[\"″s]?)?)?"
+                                         "\\s*[NSEW]?");
+
+    mgrs = anchored("\\d{1,2}\\s*" + bandLetter + "\\s*" + gridLetter + "{2}\\s*" + gridDigits);
+    ups = anchored("[ABYZ]\\s*" + gridLetter + "{2}\\s*" + gridDigits);
+    utm = anchored("\\d{1,2}(?:\\s*" + bandLetter + "\\s*|\\s+)\\d{5,7}(?:\\.\\d+)?\\s*m?\\s+\\d{1,8}(?:\\.\\d+)?\\s*m?|"
+                   "\\d{1,2}" + bandLetter + "\\d{13,15}");
+    gars = anchored("\\d{3}" + gridLetter + "{2}(?:[1-4][1-9]?)?");
+    geoRef = anchored(gridLetter + "[A-HJ-M][A-HJ-NP-Q]{2}(?:\\d\\d)*");
+    latLon = anchored(angle + "\\s*[,;/]?\\s*" + angle);
+  }
+};
+
+const Patterns& patterns()
+{
+  static const Patterns p;
+  return p;
+}
+
+bool isMatch(const QRegularExpression& pattern, const QString& text)
+{
+  return pattern.match(text).hasMatch();
+}
+
+}
+
+/*!
+  \internal
+  \inmodule EsriArcGISRuntimeToolkit
+  \class Esri::ArcGISRuntime::Toolkit::NotationClassifier
+
+  \brief Guesses the notation of free-form coordinate text without calling
+  into the \c CoordinateFormatter.
+
+  Each \c CoordinateType has a regular expression describing its syntax,
+  compiled once per process. Matching only looks at the shape of the text,
+  such as zone numbers, band letters and digit groups, not at whether the
+  values are in range, so a match is a hint about which parser to try
+  rather than a guarantee that parsing succeeds.
+
+  Some text is valid in more than one notation. MGRS and USNG share their
+  syntax, so grid references always classify as both.
+
+  Matching is thread-safe.
+
+  \sa Esri::ArcGISRuntime::Toolkit::CoordinateConversionController::formatsMatching
+ */
+
+/*!
+  \brief Returns the notations \a text may be written in, most specific
+  first. The list is empty if \a text matches none.
+ */
+QList<NotationClassifier::CoordinateType> NotationClassifier::classify(const QString& text)
+{
+  QList<CoordinateType> types;
+  const auto trimmed = text.trimmed();
+  if (trimmed.isEmpty())
+    return types;
+
+  const auto& p = patterns();
+
+  // Grid notations start with a zone number, or a polar letter for UPS.
+  // Latitude and longitude may start with either, or with a sign.
+  const QChar first = trimmed.at(0);
+  if (first.isDigit())
+  {
+    if (isMatch(p.mgrs, trimmed))
+      types << CoordinateType::Mgrs << CoordinateType::Usng;
+    else if (isMatch(p.gars, trimmed))
+      types << CoordinateType::Gars;
+    else if (isMatch(p.utm, trimmed))
+      types << CoordinateType::Utm;
+  }
+  else if (first.isLetter())
+  {
+    if (isMatch(p.ups, trimmed))
+      types << CoordinateType::Mgrs << CoordinateType::Usng;
+    else if (isMatch(p.geoRef, trimmed))
+      types << CoordinateType::GeoRef;
+  }
+
+  if (isMatch(p.latLon, trimmed))
+    types << CoordinateType::LatLon;
+
+  return types;
+}
+
+/*!
+  \brief Returns whether \a text may be written in the notation \a type.
+ */
+bool NotationClassifier::matches(const QString& text, CoordinateType type)
+{
+  return classify(text).contains(type);
+}
+
+} // Toolkit
+} // ArcGISRuntime
+} // Esri
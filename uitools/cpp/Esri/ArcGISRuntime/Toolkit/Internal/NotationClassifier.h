@@ -13,15 +13,15 @@
  *  See the License for the specific language governing permissions and
  *  limitations under the License.
  ******************************************************************************/
-#ifndef ESRI_ARCGISRUNTIME_TOOLKIT_INTERNAL_METAELEMENT_H
-#define ESRI_ARCGISRUNTIME_TOOLKIT_INTERNAL_METAELEMENT_H
+#ifndef ESRI_ARCGISRUNTIME_TOOLKIT_INTERNAL_NOTATIONCLASSIFIER_H
+#define ESRI_ARCGISRUNTIME_TOOLKIT_INTERNAL_NOTATIONCLASSIFIER_H
 
-// Qt headers
-#include <QObject>
-#include <QPersistentModelIndex>
-#include <QPointer>
+// Toolkit headers
+#include "CoordinateConversionOption.h"
 
-class QAbstractItemModel;
+// Qt headers
+#include <QList>
+#include <QString>
 
 namespace Esri
 {
@@ -30,27 +30,21 @@ namespace ArcGISRuntime
 namespace Toolkit
 {
 
-class MetaElement : public QObject
+class NotationClassifier
 {
-  Q_OBJECT
 public:
-  MetaElement(QModelIndex index, int customRole, QObject* trackedObject, QAbstractItemModel* parent);
+  using CoordinateType = CoordinateConversionOption::CoordinateType;
 
-signals:
-  void propertyChanged();
+  static QList<CoordinateType> classify(const QString& text);
 
-private slots:
-  void emitDataChanged();
+  static bool matches(const QString& text, CoordinateType type);
 
 private:
-  QPersistentModelIndex m_index;
-  int m_customRole = -1;
-  QPointer<QObject> m_trackedObject;
-  QAbstractItemModel* m_parentModel = nullptr;
+  NotationClassifier() = delete;
 };
 
-} // Esri
-} // ArcGISRuntime
 } // Toolkit
+} // ArcGISRuntime
+} // Esri
 
-#endif // ESRI_ARCGISRUNTIME_TOOLKIT_INTERNAL_METAELEMENT_H
+#endif // ESRI_ARCGISRUNTIME_TOOLKIT_INTERNAL_NOTATIONCLASSIFIER_H
@@ -0,0 +1,111 @@
+/*******************************************************************************
+ *  Copyright 2012-2020 Esri
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+#include "SignalDispatcher.h"
+
+namespace Esri
+{
+namespace ArcGISRuntime
+{
+namespace Toolkit
+{
+
+/*!
+  \internal
+
+  \inmodule EsriArcGISRuntimeToolkit
+  \class Esri::ArcGISRuntime::Toolkit::SignalDispatcher
+
+  \brief The \c SignalDispatcher is an implementation detail of
+  GenericListModel that routes any number of signals, from any number of
+  objects, to a single handler function.
+
+  Qt connection functions do not allow for connecting a lambda to a
+  \c QMetaMethod. Rather than allocating a helper \c QObject per connection,
+  each connection made through \l connectSignal targets a virtual method
+  index on this object. When the signal fires, \c qt_metacall receives that
+  index and forwards the sending object and the caller-supplied \e id to the
+  handler.
+
+  This is the same technique \c QSignalSpy uses to observe arbitrary signals.
+
+  \sa Esri::ArcGISRuntime::Toolkit::GenericListModel
+ */
+
+/*!
+  \brief Constructs a new \c SignalDispatcher.
+
+  \list
+  \li \a handler Function invoked with the sending object and the id given to
+  \l connectSignal whenever a connected signal fires.
+  \li \a parent Owning parent object.
+  \endlist
+ */
+SignalDispatcher::SignalDispatcher(Handler handler, QObject* parent) :
+  QObject(parent),
+  m_handler(std::move(handler))
+{
+}
+
+/*!
+  \brief Destructor.
+ */
+SignalDispatcher::~SignalDispatcher()
+{
+}
+
+/*!
+  \brief Connects the signal with method index \a signalIndex on \a sender to
+  this dispatcher.
+
+  When the signal is emitted the handler is called with \a sender and \a id.
+  \a id must not be negative.
+
+  Returns the connection handle.
+ */
+QMetaObject::Connection SignalDispatcher::connectSignal(const QObject* sender, int signalIndex, int id)
+{
+  if (!sender || signalIndex < 0 || id < 0)
+    return QMetaObject::Connection();
+
+  return QMetaObject::connect(sender, signalIndex, this,
+                              QObject::staticMetaObject.methodCount() + id);
+}
+
+/*!
+  \internal
+  \brief Intercepts invocations of the virtual methods targeted by
+  \l connectSignal and forwards them to the handler.
+ */
+int SignalDispatcher::qt_metacall(QMetaObject::Call call, int methodId, void** args)
+{
+  methodId = QObject::qt_metacall(call, methodId, args);
+  if (methodId < 0)
+    return methodId;
+
+  if (call == QMetaObject::InvokeMetaMethod)
+  {
+    if (m_handler)
+      m_handler(sender(), methodId);
+
+    return -1;
+  }
+
+  return methodId;
+}
+
+} // Toolkit
+} // ArcGISRuntime
+} // Esri
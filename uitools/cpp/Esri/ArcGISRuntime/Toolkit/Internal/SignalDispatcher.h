@@ -0,0 +1,56 @@
+/*******************************************************************************
+ *  Copyright 2012-2020 Esri
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+#ifndef ESRI_ARCGISRUNTIME_TOOLKIT_INTERNAL_SIGNALDISPATCHER_H
+#define ESRI_ARCGISRUNTIME_TOOLKIT_INTERNAL_SIGNALDISPATCHER_H
+
+// Qt headers
+#include <QObject>
+
+// std headers
+#include <functional>
+
+namespace Esri
+{
+namespace ArcGISRuntime
+{
+namespace Toolkit
+{
+
+// Deliberately has no Q_OBJECT macro. Incoming connections are routed to
+// method indices past the end of QObject's own methods, which we intercept
+// in qt_metacall.
+class SignalDispatcher : public QObject
+{
+public:
+  using Handler = std::function<void(QObject* sender, int id)>;
+
+  explicit SignalDispatcher(Handler handler, QObject* parent = nullptr);
+
+  ~SignalDispatcher() override;
+
+  QMetaObject::Connection connectSignal(const QObject* sender, int signalIndex, int id);
+
+  int qt_metacall(QMetaObject::Call call, int methodId, void** args) override;
+
+private:
+  Handler m_handler;
+};
+
+} // Toolkit
+} // ArcGISRuntime
+} // Esri
+
+#endif // ESRI_ARCGISRUNTIME_TOOLKIT_INTERNAL_SIGNALDISPATCHER_H
@@ -0,0 +1,329 @@
+/*******************************************************************************
+ *  Copyright 2012-2020 Esri
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+#include "TimeStepTable.h"
+
+// std headers
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace Esri
+{
+namespace ArcGISRuntime
+{
+namespace Toolkit
+{
+
+namespace
+{
+
+// Boundaries are generated in pages of this many steps, and at most
+// MAX_CACHED_PAGES pages are kept, which bounds the table to 512 KiB.
+constexpr int PAGE_SIZE = 4096;
+constexpr int MAX_CACHED_PAGES = 16;
+
+// One more boundary than steps must be addressable with an int.
+constexpr qint64 MAX_STEPS = std::numeric_limits<int>::max() - 1;
+
+constexpr double MSECS_PER_DAY = 86400000.0;
+
+// The mean Gregorian year, only used to estimate calendar steps.
+constexpr double DAYS_PER_YEAR = 365.2425;
+
+// Returns the number of months in one \a unit, or 0 if it is not a
+// multiple of months.
+int monthsPerUnit(TimeUnit unit)
+{
+  switch (unit)
+  {
+    case TimeUnit::Centuries:
+      return 1200;
+    case TimeUnit::Decades:
+      return 120;
+    case TimeUnit::Years:
+      return 12;
+    case TimeUnit::Months:
+      return 1;
+    default:
+      return 0;
+  }
+}
+
+// Returns the number of days in one \a unit, or 0 if it is not a multiple
+// of days.
+int daysPerUnit(TimeUnit unit)
+{
+  switch (unit)
+  {
+    case TimeUnit::Weeks:
+      return 7;
+    case TimeUnit::Days:
+      return 1;
+    default:
+      return 0;
+  }
+}
+
+// Returns the mean length of one \a unit in milliseconds.
+double msecsPerUnit(TimeUnit unit)
+{
+  if (const int months = monthsPerUnit(unit))
+    return months * (DAYS_PER_YEAR / 12.0) * MSECS_PER_DAY;
+
+  if (const int days = daysPerUnit(unit))
+    return days * MSECS_PER_DAY;
+
+  switch (unit)
+  {
+    case TimeUnit::Hours:
+      return 3600000.0;
+    case TimeUnit::Minutes:
+      return 60000.0;
+    case TimeUnit::Seconds:
+      return 1000.0;
+    default:
+      return 1.0;
+  }
+}
+
+}
+
+/*!
+  \internal
+  \inmodule EsriArcGISRuntimeToolkit
+  \class Esri::ArcGISRuntime::Toolkit::TimeStepTable
+
+  \brief The boundaries of the steps of a \c TimeSliderController, as exact
+  milliseconds since the epoch.
+
+  Step \c n starts \c n intervals after the start of the extent. Intervals
+  of whole days or weeks advance by calendar days, and intervals of whole
+  months, years, decades or centuries advance by calendar months, so steps
+  do not drift over long extents. Each boundary is computed from the start
+  rather than from the previous boundary, so the day of the month is kept
+  wherever the month is long enough. Fractional intervals advance by their
+  mean length in milliseconds.
+
+  Boundaries are generated lazily, in contiguous pages which are kept in a
+  small least-recently-used cache, so extents with millions of steps use
+  bounded memory. Looking up the time of a step is an index into a page, and
+  looking up the step of a time is a binary search.
+ */
+
+/*!
+  \internal
+  \brief Constructs an empty table.
+ */
+TimeStepTable::TimeStepTable() :
+  m_pages(MAX_CACHED_PAGES)
+{
+}
+
+/*!
+  \internal
+  \brief Rebuilds the table for steps of \a interval covering \a extent.
+
+  The table is empty if either is empty, or if \a interval is not positive.
+ */
+void TimeStepTable::reset(const TimeExtent& extent, const TimeValue& interval)
+{
+  clear();
+  if (extent.isEmpty() || interval.isEmpty() || !(interval.duration() > 0.0))
+    return;
+
+  const auto unit = interval.unit();
+  const double duration = interval.duration();
+  const bool whole = std::floor(duration) == duration &&
+                     duration <= std::numeric_limits<int>::max() / 1200;
+
+  qint64 maxSteps = MAX_STEPS;
+  if (whole && monthsPerUnit(unit) > 0)
+  {
+    m_arithmetic = Arithmetic::Months;
+    m_stepUnits = static_cast<int>(duration) * monthsPerUnit(unit);
+    maxSteps = std::min<qint64>(maxSteps, std::numeric_limits<int>::max() / m_stepUnits);
+  }
+  else if (whole && daysPerUnit(unit) > 0)
+  {
+    m_arithmetic = Arithmetic::Days;
+    m_stepUnits = static_cast<int>(duration) * daysPerUnit(unit);
+  }
+  else
+  {
+    m_arithmetic = Arithmetic::Milliseconds;
+  }
+
+  m_stepMsecs = duration * msecsPerUnit(unit);
+  m_start = extent.startTime();
+  m_startMsecs = m_start.toMSecsSinceEpoch();
+
+  const qint64 endMsecs = extent.endTime().toMSecsSinceEpoch();
+  if (endMsecs <= m_startMsecs)
+    return;
+
+  // Estimate the number of steps from the mean interval, then correct it
+  // so that the last boundary is the first one at or after the end.
+  const double estimate = std::ceil((endMsecs - m_startMsecs) / m_stepMsecs);
+  qint64 steps = static_cast<qint64>(std::min(std::max(estimate, 1.0), static_cast<double>(maxSteps)));
+  while (steps > 1 && computeMsecs(steps - 1) >= endMsecs)
+    --steps;
+  while (steps < maxSteps && computeMsecs(steps) < endMsecs)
+    ++steps;
+
+  m_numberOfSteps = static_cast<int>(steps);
+}
+
+/*!
+  \internal
+  \brief Empties the table.
+ */
+void TimeStepTable::clear()
+{
+  m_start = QDateTime();
+  m_startMsecs = 0;
+  m_arithmetic = Arithmetic::Milliseconds;
+  m_stepMsecs = 0.0;
+  m_stepUnits = 0;
+  m_numberOfSteps = 0;
+  m_pages.clear();
+}
+
+/*!
+  \internal
+  \brief Returns whether the table has no extent or interval.
+ */
+bool TimeStepTable::isEmpty() const
+{
+  return m_stepMsecs <= 0.0;
+}
+
+/*!
+  \internal
+  \brief Returns the number of steps, which is the index of the first
+  boundary at or after the end of the extent.
+ */
+int TimeStepTable::numberOfSteps() const
+{
+  return m_numberOfSteps;
+}
+
+/*!
+  \internal
+  \brief Returns the boundary of \a step in milliseconds since the epoch.
+
+  Steps outside \c{[0, numberOfSteps()]} are computed, not cached.
+ */
+qint64 TimeStepTable::msecsForStep(int step) const
+{
+  if (step < 0 || step > m_numberOfSteps)
+    return computeMsecs(step);
+
+  return page(step / PAGE_SIZE)[step % PAGE_SIZE];
+}
+
+/*!
+  \internal
+  \brief Returns the boundary of \a step, in the time spec of the start of
+  the extent, or an invalid \c QDateTime if the table is empty.
+ */
+QDateTime TimeStepTable::timeForStep(int step) const
+{
+  if (isEmpty())
+    return QDateTime{};
+
+  return m_start.addMSecs(msecsForStep(step) - m_startMsecs);
+}
+
+/*!
+  \internal
+  \brief Returns the first step whose boundary is at or after \a time,
+  clamped to \c{[0, numberOfSteps()]}.
+ */
+int TimeStepTable::stepForTime(const QDateTime& time) const
+{
+  if (isEmpty() || !time.isValid())
+    return 0;
+
+  const qint64 msecs = time.toMSecsSinceEpoch();
+  if (msecs <= m_startMsecs)
+    return 0;
+  else if (msecs >= msecsForStep(m_numberOfSteps))
+    return m_numberOfSteps;
+
+  // Find the last page starting before msecs from the first boundary of
+  // each page, which is computed directly, so only that page is generated.
+  int low = 0;
+  int high = m_numberOfSteps / PAGE_SIZE;
+  while (low < high)
+  {
+    const int middle = low + (high - low + 1) / 2;
+    if (computeMsecs(static_cast<qint64>(middle) * PAGE_SIZE) < msecs)
+      low = middle;
+    else
+      high = middle - 1;
+  }
+
+  // If every boundary of the page is before msecs, the answer is the first
+  // step of the next page.
+  const auto& boundaries = page(low);
+  const auto it = std::lower_bound(boundaries.cbegin(), boundaries.cend(), msecs);
+  return low * PAGE_SIZE + static_cast<int>(it - boundaries.cbegin());
+}
+
+/*!
+  \internal
+  \brief Computes the boundary of \a step from the start of the extent.
+ */
+qint64 TimeStepTable::computeMsecs(qint64 step) const
+{
+  switch (m_arithmetic)
+  {
+    case Arithmetic::Months:
+      return m_start.addMonths(static_cast<int>(step * m_stepUnits)).toMSecsSinceEpoch();
+    case Arithmetic::Days:
+      return m_start.addDays(step * m_stepUnits).toMSecsSinceEpoch();
+    default:
+      return m_startMsecs + std::llround(step * m_stepMsecs);
+  }
+}
+
+/*!
+  \internal
+  \brief Returns page \a index of the boundaries, generating it if it is not
+  cached.
+
+  The reference is only valid until the next page is generated.
+ */
+const std::vector<qint64>& TimeStepTable::page(int index) const
+{
+  if (auto boundaries = m_pages.object(index))
+    return *boundaries;
+
+  const qint64 first = static_cast<qint64>(index) * PAGE_SIZE;
+  const qint64 last = std::min<qint64>(first + PAGE_SIZE - 1, m_numberOfSteps);
+
+  auto boundaries = new std::vector<qint64>();
+  boundaries->reserve(static_cast<size_t>(last - first + 1));
+  for (qint64 step = first; step <= last; ++step)
+    boundaries->push_back(computeMsecs(step));
+
+  m_pages.insert(index, boundaries);
+  return *boundaries;
+}
+
+} // Toolkit
+} // ArcGISRuntime
+} // Esri
@@ -0,0 +1,82 @@
+/*******************************************************************************
+ *  Copyright 2012-2020 Esri
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+#ifndef ESRI_ARCGISRUNTIME_TOOLKIT_INTERNAL_TIMESTEPTABLE_H
+#define ESRI_ARCGISRUNTIME_TOOLKIT_INTERNAL_TIMESTEPTABLE_H
+
+// Qt headers
+#include <QCache>
+#include <QDateTime>
+
+// ArcGISRuntime headers
+#include <TimeExtent.h>
+#include <TimeValue.h>
+
+// std headers
+#include <vector>
+
+namespace Esri
+{
+namespace ArcGISRuntime
+{
+namespace Toolkit
+{
+
+class TimeStepTable
+{
+public:
+  TimeStepTable();
+
+  void reset(const TimeExtent& extent, const TimeValue& interval);
+
+  void clear();
+
+  bool isEmpty() const;
+
+  int numberOfSteps() const;
+
+  qint64 msecsForStep(int step) const;
+
+  QDateTime timeForStep(int step) const;
+
+  int stepForTime(const QDateTime& time) const;
+
+private:
+  enum class Arithmetic
+  {
+    Milliseconds,
+    Days,
+    Months
+  };
+
+  qint64 computeMsecs(qint64 step) const;
+
+  const std::vector<qint64>& page(int index) const;
+
+private:
+  QDateTime m_start;
+  qint64 m_startMsecs = 0;
+  Arithmetic m_arithmetic = Arithmetic::Milliseconds;
+  double m_stepMsecs = 0.0;
+  int m_stepUnits = 0;
+  int m_numberOfSteps = 0;
+  mutable QCache<int, std::vector<qint64>> m_pages;
+};
+
+} // Toolkit
+} // ArcGISRuntime
+} // Esri
+
+#endif // ESRI_ARCGISRUNTIME_TOOLKIT_INTERNAL_TIMESTEPTABLE_H
@@ -0,0 +1,804 @@
+/*******************************************************************************
+ *  Copyright 2012-2020 Esri
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+#include "TrackedPointsModel.h"
+
+// Toolkit headers
+#include "CoordinateConversionOption.h"
+#include "GridReferenceFormatter.h"
+
+// ArcGISRuntime headers
+#include <SpatialReference.h>
+
+// std headers
+#include <algorithm>
+#include <climits>
+#include <cmath>
+
+namespace Esri
+{
+namespace ArcGISRuntime
+{
+namespace Toolkit
+{
+
+namespace
+{
+
+// Digits of an MGRS or USNG reference up to which grid cells are used.
+// Finer references are converted whenever the point moves.
+constexpr int MAX_GRID_PRECISION = 8;
+
+// Size of a GARS cell, 5 minutes.
+constexpr double GARS_CELL = 5.0 / 60.0;
+
+}
+
+/*!
+  \internal
+  \inmodule EsriArcGISRuntimeToolkit
+  \class Esri::ArcGISRuntime::Toolkit::TrackedPointsModel
+
+  \brief A table of notations for many tracked points, with one row per
+  point and one column per \c CoordinateConversionOption.
+
+  Points are identified by a stable id chosen by the caller, and are added,
+  moved and removed in bulk. The model does not convert points itself.
+  Instead it records which cells need converting and emits
+  \l conversionRequired once, until the pending work is collected with
+  \l takePendingConversions. The results are handed back with
+  \l applyConversions, which emits a single \c dataChanged.
+
+  A moved point is only converted again for the columns where it left the
+  cell it was last converted in. For latitude and longitude and GARS
+  notations of WGS84 points the cells are in degrees. For UTM, MGRS and
+  USNG notations the point is projected into its UTM zone, and the cells are
+  squares of the grid precision in metres within the zone and latitude band,
+  so they line up with the grid. Points in other spatial references, and
+  outside the area covered by UTM, are converted whenever they move.
+
+  Changing the formatting of an option converts its whole column again.
+
+  \sa Esri::ArcGISRuntime::Toolkit::CoordinateConversionController
+ */
+
+/*!
+  \brief Constructor
+  \list
+  \li \a parent Owning parent QObject.
+  \endlist
+ */
+TrackedPointsModel::TrackedPointsModel(QObject* parent) :
+  QAbstractTableModel(parent),
+  m_wgs84Wkid(SpatialReference::wgs84().wkid())
+{
+}
+
+/*!
+  \brief Destructor.
+ */
+TrackedPointsModel::~TrackedPointsModel()
+{
+}
+
+/*!
+  \brief Sets the options providing the columns to \a options.
+
+  Columns whose option is in both the current and the new list keep their
+  notations, and are moved if their position changes. Columns for new
+  options are inserted and their points converted, and columns for options
+  which are no longer listed are removed.
+ */
+void TrackedPointsModel::setOptions(const QList<CoordinateConversionOption*>& options)
+{
+  const auto current = this->options();
+  if (options == current)
+    return;
+
+  // Keep one existing column for each time an option is listed.
+  QHash<CoordinateConversionOption*, int> wanted;
+  for (auto option : options)
+  {
+    if (option)
+      ++wanted[option];
+  }
+
+  QVector<int> removed;
+  for (int column = 0; column < current.size(); ++column)
+  {
+    const auto it = wanted.find(current.at(column));
+    if (it != wanted.end() && it.value() > 0)
+      --it.value();
+    else
+      removed.append(column);
+  }
+
+  // Remove contiguous runs from the back, so earlier columns keep their index.
+  int last = removed.size() - 1;
+  while (last >= 0)
+  {
+    int first = last;
+    while (first > 0 && removed.at(first - 1) == removed.at(first) - 1)
+      --first;
+
+    eraseColumns(removed.at(first), removed.at(last));
+    last = first - 1;
+  }
+
+  // The kept columns are in their old order. Move each one into place, and
+  // insert the new ones around them.
+  for (int column = 0; column < options.size(); ++column)
+  {
+    auto option = options.at(column);
+    if (column < m_options.size() && option && m_options.at(column).data() == option)
+      continue;
+
+    int from = -1;
+    for (int i = column + 1; option && i < m_options.size() && from < 0; ++i)
+    {
+      if (m_options.at(i).data() == option)
+        from = i;
+    }
+
+    if (from < 0)
+      insertColumn(column, option);
+    else
+      moveColumn(from, column);
+  }
+
+  const QSet<CoordinateConversionOption*> before(current.cbegin(), current.cend());
+  const QSet<CoordinateConversionOption*> after(options.cbegin(), options.cend());
+  for (auto option : before)
+  {
+    if (option && !after.contains(option))
+      disconnect(option, nullptr, this, nullptr);
+  }
+
+  for (auto option : after)
+  {
+    if (option && !before.contains(option))
+      connectOption(option);
+  }
+}
+
+/*!
+  \brief Returns the options providing the columns.
+ */
+QList<CoordinateConversionOption*> TrackedPointsModel::options() const
+{
+  QList<CoordinateConversionOption*> options;
+  options.reserve(m_options.size());
+  for (const auto& option : m_options)
+    options.append(option.data());
+
+  return options;
+}
+
+/*!
+  \brief Sets the position of each point in \a points, keyed by id.
+
+  Unknown ids are appended as new rows, in ascending order of id.
+ */
+void TrackedPointsModel::updatePoints(const QHash<qint64, Point>& points)
+{
+  const int columns = m_options.size();
+  QVector<qint64> added;
+  int firstMoved = INT_MAX;
+  int lastMoved = -1;
+  for (auto it = points.constBegin(); it != points.constEnd(); ++it)
+  {
+    const int row = m_rows.value(it.key(), -1);
+    if (row < 0)
+    {
+      added.append(it.key());
+      continue;
+    }
+
+    if (m_points.at(row) == it.value())
+      continue;
+
+    m_points[row] = it.value();
+    firstMoved = std::min(firstMoved, row);
+    lastMoved = std::max(lastMoved, row);
+    for (int column = 0; column < columns; ++column)
+      requestConversion(row, column);
+  }
+
+  if (lastMoved >= 0 && columns > 0)
+    emit dataChanged(index(firstMoved, 0), index(lastMoved, columns - 1), { PointRole });
+
+  if (added.isEmpty())
+    return;
+
+  std::sort(added.begin(), added.end());
+  const int first = m_ids.size();
+  beginInsertRows(QModelIndex(), first, first + added.size() - 1);
+  for (const auto id : added)
+  {
+    m_rows.insert(id, m_ids.size());
+    m_ids.append(id);
+    m_points.append(points.value(id));
+  }
+
+  for (int column = 0; column < columns; ++column)
+  {
+    m_notations[column].resize(m_ids.size());
+    m_requestedCells[column].resize(m_ids.size());
+  }
+  endInsertRows();
+
+  for (int column = 0; column < columns; ++column)
+  {
+    for (int row = first; row < m_ids.size(); ++row)
+      requestConversion(row, column);
+  }
+}
+
+/*!
+  \brief Removes the points with the given \a ids. Unknown ids are ignored.
+ */
+void TrackedPointsModel::removePoints(const QList<qint64>& ids)
+{
+  QVector<int> rows;
+  rows.reserve(ids.size());
+  for (const auto id : ids)
+  {
+    const int row = m_rows.value(id, -1);
+    if (row >= 0)
+      rows.append(row);
+  }
+
+  if (rows.isEmpty())
+    return;
+
+  std::sort(rows.begin(), rows.end());
+  rows.erase(std::unique(rows.begin(), rows.end()), rows.end());
+
+  for (auto& pending : m_pending)
+  {
+    for (const auto row : rows)
+      pending.remove(m_ids.at(row));
+  }
+
+  for (const auto row : rows)
+    m_rows.remove(m_ids.at(row));
+
+  // Remove contiguous runs from the back, so earlier rows keep their index.
+  int last = rows.size() - 1;
+  while (last >= 0)
+  {
+    int first = last;
+    while (first > 0 && rows.at(first - 1) == rows.at(first) - 1)
+      --first;
+
+    const int begin = rows.at(first);
+    const int end = rows.at(last) + 1;
+    beginRemoveRows(QModelIndex(), begin, end - 1);
+    m_ids.erase(m_ids.begin() + begin, m_ids.begin() + end);
+    m_points.erase(m_points.begin() + begin, m_points.begin() + end);
+    for (auto& notations : m_notations)
+      notations.erase(notations.begin() + begin, notations.begin() + end);
+
+    for (auto& cells : m_requestedCells)
+      cells.erase(cells.begin() + begin, cells.begin() + end);
+
+    endRemoveRows();
+    last = first - 1;
+  }
+
+  for (int row = rows.first(); row < m_ids.size(); ++row)
+    m_rows[m_ids.at(row)] = row;
+}
+
+/*!
+  \brief Removes all points.
+ */
+void TrackedPointsModel::clear()
+{
+  beginResetModel();
+  m_ids.clear();
+  m_rows.clear();
+  m_points.clear();
+  for (auto& notations : m_notations)
+    notations.clear();
+
+  for (auto& cells : m_requestedCells)
+    cells.clear();
+
+  for (auto& pending : m_pending)
+    pending.clear();
+
+  endResetModel();
+}
+
+/*!
+  \brief Returns whether a point with \a id is tracked.
+ */
+bool TrackedPointsModel::contains(qint64 id) const
+{
+  return m_rows.contains(id);
+}
+
+/*!
+  \brief Returns the position of the point with \a id, or an empty point if
+  there is none.
+ */
+Point TrackedPointsModel::point(qint64 id) const
+{
+  const int row = m_rows.value(id, -1);
+  return row < 0 ? Point() : m_points.at(row);
+}
+
+/*!
+  \brief Returns the notation of the point with \a id in \a column.
+ */
+QString TrackedPointsModel::notation(qint64 id, int column) const
+{
+  const int row = m_rows.value(id, -1);
+  if (row < 0 || column < 0 || column >= m_notations.size())
+    return QString();
+
+  return m_notations.at(column).at(row);
+}
+
+/*!
+  \brief Returns whether any cell is waiting to be converted.
+ */
+bool TrackedPointsModel::hasPendingConversions() const
+{
+  return std::any_of(m_pending.cbegin(), m_pending.cend(), [](const QSet<qint64>& pending)
+  {
+    return !pending.isEmpty();
+  });
+}
+
+/*!
+  \brief Returns every cell waiting to be converted, grouped by column into
+  conversions of at most \a chunkSize points, and clears the pending work.
+
+  \l conversionRequired is emitted again the next time a cell needs
+  converting.
+ */
+QVector<TrackedPointsModel::Conversion> TrackedPointsModel::takePendingConversions(int chunkSize)
+{
+  m_conversionRequired = false;
+  chunkSize = std::max(1, chunkSize);
+
+  QVector<Conversion> conversions;
+  for (int column = 0; column < m_pending.size(); ++column)
+  {
+    auto& pending = m_pending[column];
+    const auto option = m_options.at(column);
+    if (!option)
+    {
+      pending.clear();
+      continue;
+    }
+
+    Conversion conversion;
+    for (const auto id : pending)
+    {
+      const int row = m_rows.value(id, -1);
+      if (row < 0)
+        continue;
+
+      if (conversion.ids.isEmpty())
+      {
+        conversion.column = column;
+        conversion.option = option;
+      }
+
+      conversion.ids.append(id);
+      conversion.points.append(m_points.at(row));
+      conversion.cells.append(m_requestedCells.at(column).at(row));
+      if (conversion.ids.size() == chunkSize)
+      {
+        conversions.append(conversion);
+        conversion = Conversion();
+      }
+    }
+
+    if (!conversion.ids.isEmpty())
+      conversions.append(conversion);
+
+    pending.clear();
+  }
+  return conversions;
+}
+
+/*!
+  \brief Stores \a notations, which hold one list per conversion in
+  \a conversions, and emits one \c dataChanged covering every changed cell.
+
+  Notations are dropped for points which were removed, or which moved to
+  another cell, since their conversion was taken. The newer position is
+  already pending in that case. Notations for a column which has moved
+  since are stored in its new position.
+ */
+void TrackedPointsModel::applyConversions(const QVector<Conversion>& conversions,
+                                          const QVector<QStringList>& notations)
+{
+  int firstRow = INT_MAX;
+  int lastRow = -1;
+  int firstColumn = INT_MAX;
+  int lastColumn = -1;
+  for (int i = 0; i < conversions.size() && i < notations.size(); ++i)
+  {
+    const auto& conversion = conversions.at(i);
+    if (!conversion.option)
+      continue;
+
+    // The column may have moved since the conversion was taken.
+    int column = conversion.column;
+    if (column < 0 || column >= m_options.size() ||
+        m_options.at(column).data() != conversion.option.data())
+      column = m_options.indexOf(conversion.option);
+
+    if (column < 0)
+      continue;
+
+    const auto& list = notations.at(i);
+    for (int j = 0; j < conversion.ids.size() && j < list.size(); ++j)
+    {
+      const int row = m_rows.value(conversion.ids.at(j), -1);
+      if (row < 0 || m_requestedCells.at(column).at(row) != conversion.cells.at(j))
+        continue;
+
+      auto& notation = m_notations[column][row];
+      if (notation == list.at(j))
+        continue;
+
+      notation = list.at(j);
+      firstRow = std::min(firstRow, row);
+      lastRow = std::max(lastRow, row);
+      firstColumn = std::min(firstColumn, column);
+      lastColumn = std::max(lastColumn, column);
+    }
+  }
+
+  if (lastRow >= 0)
+    emit dataChanged(index(firstRow, firstColumn), index(lastRow, lastColumn), { Qt::DisplayRole, Qt::EditRole });
+}
+
+/*!
+  \brief Returns the number of tracked points if \a parent is invalid,
+  otherwise 0.
+ */
+int TrackedPointsModel::rowCount(const QModelIndex& parent) const
+{
+  return parent.isValid() ? 0 : m_ids.size();
+}
+
+/*!
+  \brief Returns the number of options if \a parent is invalid, otherwise 0.
+ */
+int TrackedPointsModel::columnCount(const QModelIndex& parent) const
+{
+  return parent.isValid() ? 0 : m_options.size();
+}
+
+/*!
+  \brief Returns the notation for \c Qt::DisplayRole and \c Qt::EditRole,
+  and the id and position of the point for \c pointId and \c point.
+ */
+QVariant TrackedPointsModel::data(const QModelIndex& index, int role) const
+{
+  if (!index.isValid() || index.row() >= m_ids.size() || index.column() >= m_options.size())
+    return QVariant();
+
+  switch (role)
+  {
+    case Qt::DisplayRole:
+    case Qt::EditRole:
+      return m_notations.at(index.column()).at(index.row());
+    case PointIdRole:
+      return m_ids.at(index.row());
+    case PointRole:
+      return QVariant::fromValue(m_points.at(index.row()));
+    default:
+      return QVariant();
+  }
+}
+
+/*!
+  \brief Returns the option name for columns and the point id for rows.
+ */
+QVariant TrackedPointsModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+  if (role != Qt::DisplayRole)
+    return QAbstractTableModel::headerData(section, orientation, role);
+
+  if (orientation == Qt::Horizontal && section >= 0 && section < m_options.size())
+  {
+    const auto option = m_options.at(section);
+    return option ? option->name() : QString();
+  }
+  else if (orientation == Qt::Vertical && section >= 0 && section < m_ids.size())
+  {
+    return m_ids.at(section);
+  }
+
+  return QAbstractTableModel::headerData(section, orientation, role);
+}
+
+/*!
+  \brief Returns the role names, adding \c pointId and \c point to the
+  defaults.
+ */
+QHash<int, QByteArray> TrackedPointsModel::roleNames() const
+{
+  auto roles = QAbstractTableModel::roleNames();
+  roles.insert(PointIdRole, "pointId");
+  roles.insert(PointRole, "point");
+  return roles;
+}
+
+/*!
+  \internal
+  \brief Returns the size of the cells within which the notation of
+  \a option does not change. The size is in degrees, or in metres for
+  projected grid notations.
+
+  A resolution of \c 0 means any movement changes the notation.
+ */
+TrackedPointsModel::Quantizer TrackedPointsModel::quantizerFor(const CoordinateConversionOption* option)
+{
+  Quantizer quantizer;
+  if (!option)
+    return quantizer;
+
+  switch (option->outputMode())
+  {
+    case CoordinateConversionOption::CoordinateType::LatLon:
+    {
+      double unit = 1.0;
+      if (option->latLonFormat() == LatitudeLongitudeFormat::DegreesDecimalMinutes)
+        unit = 1.0 / 60.0;
+      else if (option->latLonFormat() == LatitudeLongitudeFormat::DegreesMinutesSeconds)
+        unit = 1.0 / 3600.0;
+
+      quantizer.resolution = unit * std::pow(10.0, -option->decimalPlaces());
+      break;
+    }
+    case CoordinateConversionOption::CoordinateType::Mgrs:
+    case CoordinateConversionOption::CoordinateType::Usng:
+    {
+      // The digits of a grid reference truncate, and the 100km square
+      // letters change on multiples of every resolution.
+      const int precision = option->outputMode() == CoordinateConversionOption::CoordinateType::Mgrs
+          ? option->decimalPlaces()
+          : option->precision();
+      if (precision < 0 || precision > MAX_GRID_PRECISION)
+        break;
+
+      quantizer.resolution = std::pow(10.0, 5 - precision);
+      quantizer.truncate = true;
+      quantizer.projected = true;
+      break;
+    }
+    case CoordinateConversionOption::CoordinateType::Utm:
+      quantizer.resolution = 1.0;
+      quantizer.projected = true;
+      break;
+    case CoordinateConversionOption::CoordinateType::Gars:
+      quantizer.resolution = GARS_CELL;
+      quantizer.truncate = true;
+      break;
+    case CoordinateConversionOption::CoordinateType::GeoRef:
+      quantizer.resolution = std::pow(10.0, 2 - std::max(0, option->precision())) / 60.0;
+      quantizer.truncate = true;
+      break;
+    default:
+      break;
+  }
+  return quantizer;
+}
+
+/*!
+  \internal
+  \brief Returns the cell of \a point in \a column.
+ */
+TrackedPointsModel::Cell TrackedPointsModel::cellOf(const Point& point, int column) const
+{
+  Cell cell;
+  if (point.isEmpty())
+    return cell;
+
+  cell.valid = true;
+  cell.x = point.x();
+  cell.y = point.y();
+
+  const auto& quantizer = m_quantizers.at(column);
+  if (quantizer.resolution <= 0.0 || point.spatialReference().wkid() != m_wgs84Wkid)
+    return cell;
+
+  if (quantizer.projected)
+  {
+    if (!GridReferenceFormatter::canFormat(cell.y, cell.x))
+      return cell;
+
+    GridReferenceFormatter::Projected projected;
+    GridReferenceFormatter::project(&cell.y, &cell.x, 1, &projected);
+    cell.x = projected.easting;
+    cell.y = projected.northing;
+    cell.zone = projected.zone;
+    cell.band = projected.band;
+  }
+
+  const double offset = quantizer.truncate ? 0.0 : 0.5;
+  cell.x = std::floor(cell.x / quantizer.resolution + offset);
+  cell.y = std::floor(cell.y / quantizer.resolution + offset);
+  return cell;
+}
+
+/*!
+  \internal
+  \brief Marks the point at \a row as pending in \a column if it left the
+  cell it was last converted in.
+ */
+void TrackedPointsModel::requestConversion(int row, int column)
+{
+  const auto cell = cellOf(m_points.at(row), column);
+  auto& requested = m_requestedCells[column][row];
+  if (cell == requested)
+    return;
+
+  requested = cell;
+  if (!cell.valid)
+  {
+    // Empty points have no notation and nothing to convert.
+    m_pending[column].remove(m_ids.at(row));
+    if (!m_notations.at(column).at(row).isEmpty())
+    {
+      m_notations[column][row].clear();
+      emit dataChanged(index(row, column), index(row, column), { Qt::DisplayRole, Qt::EditRole });
+    }
+    return;
+  }
+
+  m_pending[column].insert(m_ids.at(row));
+  notifyConversionRequired();
+}
+
+/*!
+  \internal
+  \brief Converts every point in \a column again after its option changed.
+ */
+void TrackedPointsModel::invalidateColumn(int column)
+{
+  if (column < 0 || column >= m_options.size())
+    return;
+
+  m_quantizers[column] = quantizerFor(m_options.at(column));
+  auto& cells = m_requestedCells[column];
+  std::fill(cells.begin(), cells.end(), Cell());
+  for (int row = 0; row < m_ids.size(); ++row)
+    requestConversion(row, column);
+}
+
+/*!
+  \internal
+  \brief Converts every column of \a option again after it changed.
+ */
+void TrackedPointsModel::invalidateOption(const CoordinateConversionOption* option)
+{
+  for (int column = 0; column < m_options.size(); ++column)
+  {
+    if (m_options.at(column).data() == option)
+      invalidateColumn(column);
+  }
+}
+
+/*!
+  \internal
+  \brief Connects to the signals of \a option which change its columns.
+ */
+void TrackedPointsModel::connectOption(CoordinateConversionOption* option)
+{
+  auto invalidate = [this, option]
+  {
+    invalidateOption(option);
+  };
+  connect(option, &CoordinateConversionOption::outputModeChanged, this, invalidate);
+  connect(option, &CoordinateConversionOption::hasSpacesChanged, this, invalidate);
+  connect(option, &CoordinateConversionOption::precisionChanged, this, invalidate);
+  connect(option, &CoordinateConversionOption::decimalPlacesChanged, this, invalidate);
+  connect(option, &CoordinateConversionOption::mgrsConversionModeChanged, this, invalidate);
+  connect(option, &CoordinateConversionOption::latLonFormatChanged, this, invalidate);
+  connect(option, &CoordinateConversionOption::utmConversionModeChanged, this, invalidate);
+  connect(option, &CoordinateConversionOption::garsConversionModeChanged, this, invalidate);
+  connect(option, &CoordinateConversionOption::nameChanged, this, [this, option]
+  {
+    for (int column = 0; column < m_options.size(); ++column)
+    {
+      if (m_options.at(column).data() == option)
+        emit headerDataChanged(Qt::Horizontal, column, column);
+    }
+  });
+}
+
+/*!
+  \internal
+  \brief Inserts a column for \a option at \a column and requests the
+  conversion of every point in it.
+ */
+void TrackedPointsModel::insertColumn(int column, CoordinateConversionOption* option)
+{
+  const int rows = m_ids.size();
+  beginInsertColumns(QModelIndex(), column, column);
+  m_options.insert(column, option);
+  m_quantizers.insert(column, quantizerFor(option));
+  m_notations.insert(column, QVector<QString>(rows));
+  m_requestedCells.insert(column, QVector<Cell>(rows));
+  m_pending.insert(column, QSet<qint64>());
+  endInsertColumns();
+
+  for (int row = 0; row < rows; ++row)
+    requestConversion(row, column);
+}
+
+/*!
+  \internal
+  \brief Moves the column at \a from, with its notations and pending work,
+  to \a to, which is before it.
+ */
+void TrackedPointsModel::moveColumn(int from, int to)
+{
+  beginMoveColumns(QModelIndex(), from, from, QModelIndex(), to);
+  m_options.move(from, to);
+  m_quantizers.move(from, to);
+  m_notations.move(from, to);
+  m_requestedCells.move(from, to);
+  m_pending.move(from, to);
+  endMoveColumns();
+}
+
+/*!
+  \internal
+  \brief Removes the columns from \a first to \a last inclusive.
+ */
+void TrackedPointsModel::eraseColumns(int first, int last)
+{
+  beginRemoveColumns(QModelIndex(), first, last);
+  m_options.erase(m_options.begin() + first, m_options.begin() + last + 1);
+  m_quantizers.erase(m_quantizers.begin() + first, m_quantizers.begin() + last + 1);
+  m_notations.erase(m_notations.begin() + first, m_notations.begin() + last + 1);
+  m_requestedCells.erase(m_requestedCells.begin() + first, m_requestedCells.begin() + last + 1);
+  m_pending.erase(m_pending.begin() + first, m_pending.begin() + last + 1);
+  endRemoveColumns();
+}
+
+/*!
+  \internal
+  \brief Emits \l conversionRequired unless it was already emitted since
+  the pending work was last taken.
+ */
+void TrackedPointsModel::notifyConversionRequired()
+{
+  if (m_conversionRequired)
+    return;
+
+  m_conversionRequired = true;
+  emit conversionRequired();
+}
+
+/*!
+  \fn void Esri::ArcGISRuntime::Toolkit::TrackedPointsModel::conversionRequired()
+  \brief Emitted when a cell needs converting and there was no pending work.
+ */
+
+} // Toolkit
+} // ArcGISRuntime
+} // Esri
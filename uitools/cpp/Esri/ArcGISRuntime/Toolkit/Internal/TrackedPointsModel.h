@@ -0,0 +1,167 @@
+/*******************************************************************************
+ *  Copyright 2012-2020 Esri
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+#ifndef ESRI_ARCGISRUNTIME_TOOLKIT_INTERNAL_TRACKEDPOINTSMODEL_H
+#define ESRI_ARCGISRUNTIME_TOOLKIT_INTERNAL_TRACKEDPOINTSMODEL_H
+
+// Qt headers
+#include <QAbstractTableModel>
+#include <QHash>
+#include <QList>
+#include <QPointer>
+#include <QSet>
+#include <QStringList>
+#include <QVector>
+
+// ArcGISRuntime headers
+#include <Point.h>
+
+namespace Esri
+{
+namespace ArcGISRuntime
+{
+namespace Toolkit
+{
+
+class CoordinateConversionOption;
+
+class TrackedPointsModel : public QAbstractTableModel
+{
+  Q_OBJECT
+public:
+  enum Roles
+  {
+    PointIdRole = Qt::UserRole + 1,
+    PointRole
+  };
+
+  // A cell of a point after quantizing it to the precision of a format.
+  // Grid cells are in the UTM zone and latitude band of the point.
+  struct Cell
+  {
+    double x = 0.0;
+    double y = 0.0;
+    int zone = 0;
+    int band = 0;
+    bool valid = false;
+
+    bool operator==(const Cell& other) const
+    {
+      return valid == other.valid && x == other.x && y == other.y &&
+             zone == other.zone && band == other.band;
+    }
+
+    bool operator!=(const Cell& other) const
+    {
+      return !(*this == other);
+    }
+  };
+
+  // Points of one column that need converting.
+  struct Conversion
+  {
+    int column = -1;
+    QPointer<CoordinateConversionOption> option;
+    QVector<qint64> ids;
+    QList<Point> points;
+    QVector<Cell> cells;
+  };
+
+  explicit TrackedPointsModel(QObject* parent = nullptr);
+
+  ~TrackedPointsModel() override;
+
+  void setOptions(const QList<CoordinateConversionOption*>& options);
+
+  QList<CoordinateConversionOption*> options() const;
+
+  void updatePoints(const QHash<qint64, Point>& points);
+
+  void removePoints(const QList<qint64>& ids);
+
+  void clear();
+
+  bool contains(qint64 id) const;
+
+  Point point(qint64 id) const;
+
+  QString notation(qint64 id, int column) const;
+
+  bool hasPendingConversions() const;
+
+  QVector<Conversion> takePendingConversions(int chunkSize);
+
+  void applyConversions(const QVector<Conversion>& conversions, const QVector<QStringList>& notations);
+
+  int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+
+  int columnCount(const QModelIndex& parent = QModelIndex()) const override;
+
+  QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+
+  QVariant headerData(int section, Qt::Orientation orientation,
+                      int role = Qt::DisplayRole) const override;
+
+  QHash<int, QByteArray> roleNames() const override;
+
+signals:
+  void conversionRequired();
+
+private:
+  struct Quantizer
+  {
+    double resolution = 0.0;
+    bool truncate = false;
+    bool projected = false;
+  };
+
+  static Quantizer quantizerFor(const CoordinateConversionOption* option);
+
+  Cell cellOf(const Point& point, int column) const;
+
+  void requestConversion(int row, int column);
+
+  void invalidateColumn(int column);
+
+  void invalidateOption(const CoordinateConversionOption* option);
+
+  void connectOption(CoordinateConversionOption* option);
+
+  void insertColumn(int column, CoordinateConversionOption* option);
+
+  void moveColumn(int from, int to);
+
+  void eraseColumns(int first, int last);
+
+  void notifyConversionRequired();
+
+private:
+  QVector<qint64> m_ids;
+  QHash<qint64, int> m_rows;
+  QVector<Point> m_points;
+  QList<QPointer<CoordinateConversionOption>> m_options;
+  QVector<Quantizer> m_quantizers;
+  QVector<QVector<QString>> m_notations;
+  QVector<QVector<Cell>> m_requestedCells;
+  QVector<QSet<qint64>> m_pending;
+  int m_wgs84Wkid = 0;
+  bool m_conversionRequired = false;
+};
+
+} // Toolkit
+} // ArcGISRuntime
+} // Esri
+
+#endif // ESRI_ARCGISRUNTIME_TOOLKIT_INTERNAL_TRACKEDPOINTSMODEL_H
@@ -0,0 +1,553 @@
+/*******************************************************************************
+ *  Copyright 2012-2020 Esri
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+#ifndef ESRI_ARCGISRUNTIME_TOOLKIT_INTERNAL_TYPEDGENERICLISTMODEL_H
+#define ESRI_ARCGISRUNTIME_TOOLKIT_INTERNAL_TYPEDGENERICLISTMODEL_H
+
+// Toolkit headers
+#include "SignalDispatcher.h"
+
+// Qt headers
+#include <QAbstractListModel>
+#include <QHash>
+#include <QList>
+#include <QMetaMethod>
+#include <QTimer>
+#include <QVector>
+
+// std headers
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace Esri
+{
+namespace ArcGISRuntime
+{
+namespace Toolkit
+{
+
+/*!
+  \internal
+  \brief Compile-time description of one property exposed by a
+  TypedGenericListModel.
+
+  \c Setter and \c Notify may be \c std::nullptr_t for read-only and constant
+  properties respectively.
+
+  \sa typedProperty
+ */
+template <typename Getter, typename Setter, typename Notify>
+struct TypedProperty
+{
+  const char* name;
+  Getter getter;
+  Setter setter;
+  Notify notify;
+};
+
+/*!
+  \internal
+  \brief Helper to deduce the types of a TypedProperty.
+
+  \code
+  static constexpr auto modelProperties()
+  {
+    return std::make_tuple(
+      typedProperty("name", &Foo::name, &Foo::setName, &Foo::nameChanged),
+      typedProperty("value", &Foo::value, nullptr, &Foo::valueChanged));
+  }
+  \endcode
+ */
+template <typename Getter, typename Setter, typename Notify>
+constexpr TypedProperty<Getter, Setter, Notify> typedProperty(
+  const char* name, Getter getter, Setter setter, Notify notify)
+{
+  return TypedProperty<Getter, Setter, Notify>{name, getter, setter, notify};
+}
+
+/*!
+  \internal
+  \brief Supplies the tuple of TypedProperty descriptions for \c T.
+
+  By default this forwards to a static constexpr \c T::modelProperties()
+  function. Specialize this template to describe types which cannot be
+  modified.
+ */
+template <typename T>
+struct TypedModelTraits
+{
+  static constexpr auto properties()
+  {
+    return T::modelProperties();
+  }
+};
+
+namespace TypedModelDetail
+{
+
+template <typename T, typename Getter>
+QVariant read(const T* o, Getter getter)
+{
+  return QVariant::fromValue((o->*getter)());
+}
+
+template <typename T>
+bool write(T* /*o*/, const QVariant& /*value*/, std::nullptr_t)
+{
+  return false;
+}
+
+template <typename T, typename C, typename Arg>
+bool write(T* o, const QVariant& value, void (C::*setter)(Arg))
+{
+  using Value = typename std::decay<Arg>::type;
+  if (!value.canConvert<Value>())
+    return false;
+
+  (o->*setter)(value.value<Value>());
+  return true;
+}
+
+template <typename T>
+T* create(QObject* parent, std::true_type)
+{
+  return new T(parent);
+}
+
+template <typename T>
+T* create(QObject* /*parent*/, std::false_type)
+{
+  return nullptr;
+}
+
+// Returns a new T owned by parent, or nullptr if T has no constructor taking
+// a parent.
+template <typename T>
+T* create(QObject* parent)
+{
+  return create<T>(parent, std::is_constructible<T, QObject*>{});
+}
+
+template <typename Signal>
+int signalIndex(Signal signal)
+{
+  return QMetaMethod::fromSignal(signal).methodIndex();
+}
+
+inline int signalIndex(std::nullptr_t)
+{
+  return -1;
+}
+
+} // TypedModelDetail
+
+/*!
+  \internal
+  \inmodule EsriArcGISRuntimeToolkit
+  \class Esri::ArcGISRuntime::Toolkit::TypedGenericListModel
+
+  \brief A list model over objects of a known type \c T, exposing the same
+  roles as a GenericListModel without going through \c QMetaProperty.
+
+  The properties of \c T are described at compile time by
+  TypedModelTraits<T>::properties(), a tuple of TypedProperty values. Reads and
+  writes are dispatched through static tables of function pointers indexed by
+  role, and \l element returns the stored pointer directly instead of
+  round-tripping through \c QVariant.
+
+  Roles are assigned as in GenericListModel: \c modelData is
+  \c Qt::UserRole, followed by each described property in tuple order starting
+  at \c{Qt::UserRole + 1}.
+
+  Notify signals are routed through a single SignalDispatcher, and objects
+  deleted externally are removed from the model from the event loop, so
+  objects deleted together share one removal pass.
+
+  Rows are looked up through the same index as in GenericListModel: the hash
+  of object to row is only renumbered from the first changed row onwards,
+  and only when a lookup lands in that stale tail.
+
+  As with GenericListModel, \l insertRows requires \c T to have a
+  constructor of the form \c{T(QObject* parent)}, and fails otherwise.
+
+  \sa Esri::ArcGISRuntime::Toolkit::GenericListModel
+ */
+template <typename T>
+class TypedGenericListModel : public QAbstractListModel
+{
+  static_assert(std::is_base_of<QObject, T>::value, "Must inherit QObject");
+
+  using Properties = decltype(TypedModelTraits<T>::properties());
+  using Reader = QVariant (*)(const T*);
+  using Writer = bool (*)(T*, const QVariant&);
+  using Indices = std::make_index_sequence<std::tuple_size<Properties>::value>;
+
+public:
+  explicit TypedGenericListModel(QObject* parent = nullptr) :
+    QAbstractListModel(parent),
+    m_dispatcher(new SignalDispatcher(
+      [this](QObject* sender, int id)
+      {
+        elementSignalled(sender, id);
+      }, this))
+  {
+  }
+
+  ~TypedGenericListModel() override = default;
+
+  static constexpr int propertyCount()
+  {
+    return static_cast<int>(std::tuple_size<Properties>::value);
+  }
+
+  void setDisplayPropertyName(const QByteArray& propertyName)
+  {
+    m_displayRole = -1;
+    const auto& names = roleNamesTable();
+    for (auto it = names.cbegin(); it != names.cend(); ++it)
+    {
+      if (it.key() != Qt::UserRole && it.value() == propertyName)
+      {
+        m_displayRole = it.key();
+        break;
+      }
+    }
+  }
+
+  int rowCount(const QModelIndex& parent = QModelIndex()) const override
+  {
+    return parent.isValid() ? 0 : m_objects.size();
+  }
+
+  QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override
+  {
+    const T* o = element(index);
+    if (!o)
+      return QVariant();
+
+    if (role == Qt::DisplayRole || role == Qt::EditRole)
+      role = m_displayRole;
+
+    if (role == Qt::UserRole)
+      return QVariant::fromValue<QObject*>(const_cast<T*>(o));
+
+    const int i = role - (Qt::UserRole + 1);
+    if (i < 0 || i >= propertyCount())
+      return QVariant();
+
+    return readers(Indices{})[i](o);
+  }
+
+  bool setData(const QModelIndex& index, const QVariant& value, int role = Qt::EditRole) override
+  {
+    T* o = element(index);
+    if (!o)
+      return false;
+
+    if (role == Qt::DisplayRole || role == Qt::EditRole)
+      role = m_displayRole;
+
+    const int i = role - (Qt::UserRole + 1);
+    if (i < 0 || i >= propertyCount())
+      return false;
+
+    return writers(Indices{})[i](o, value);
+  }
+
+  QHash<int, QByteArray> roleNames() const override
+  {
+    return roleNamesTable();
+  }
+
+  bool insertRows(int row, int count, const QModelIndex& parent = QModelIndex()) override
+  {
+    if (parent.isValid() || count < 1 || row < 0 || row > m_objects.size())
+      return false;
+
+    QVector<T*> created;
+    created.reserve(count);
+    for (int i = 0; i < count; ++i)
+    {
+      T* o = TypedModelDetail::create<T>(this);
+      if (!o)
+      {
+        qDeleteAll(created);
+        return false;
+      }
+      created.append(o);
+    }
+
+    beginInsertRows(parent, row, row + count - 1);
+    m_objects.insert(m_objects.begin() + row, count, nullptr);
+    for (int i = 0; i < count; ++i)
+      m_objects[row + i] = created.at(i);
+
+    m_indexedRows = std::min(m_indexedRows, row);
+    endInsertRows();
+
+    for (auto o : created)
+      connectElement(o);
+
+    return true;
+  }
+
+  bool removeRows(int row, int count, const QModelIndex& parent = QModelIndex()) override
+  {
+    if (parent.isValid() || row < 0 || count < 0 || row + count > m_objects.size())
+      return false;
+    else if (count == 0)
+      return true;
+
+    beginRemoveRows(parent, row, row + count - 1);
+    const auto first = m_objects.begin() + row;
+    const auto last = first + count;
+    for (auto it = first; it != last; ++it)
+    {
+      if (*it)
+      {
+        m_rows.remove(*it);
+        disconnect(*it, nullptr, m_dispatcher, nullptr);
+        delete *it;
+      }
+    }
+    m_objects.erase(first, last);
+    m_indexedRows = std::min(m_indexedRows, row);
+    endRemoveRows();
+    return true;
+  }
+
+  bool append(T* object)
+  {
+    if (!object)
+      return false;
+
+    return append(QList<T*>{object});
+  }
+
+  bool append(const QList<T*>& objects)
+  {
+    const int size = objects.size();
+    if (size < 1)
+      return true;
+
+    for (auto o : objects)
+    {
+      if (!o)
+        return false;
+    }
+
+    const int first = m_objects.size();
+    beginInsertRows(QModelIndex(), first, first + size - 1);
+    m_objects.reserve(first + size);
+    for (auto o : objects)
+      m_objects.append(o);
+    endInsertRows();
+
+    for (auto o : objects)
+      connectElement(o);
+
+    return true;
+  }
+
+  T* element(const QModelIndex& index) const
+  {
+    if (!index.isValid() || index.model() != this)
+      return nullptr;
+
+    return at(index.row());
+  }
+
+  T* at(int row) const
+  {
+    if (row < 0 || row >= m_objects.size())
+      return nullptr;
+
+    return m_objects.at(row);
+  }
+
+private:
+  template <std::size_t I>
+  static QVariant readAt(const T* o)
+  {
+    constexpr auto properties = TypedModelTraits<T>::properties();
+    return TypedModelDetail::read(o, std::get<I>(properties).getter);
+  }
+
+  template <std::size_t I>
+  static bool writeAt(T* o, const QVariant& value)
+  {
+    constexpr auto properties = TypedModelTraits<T>::properties();
+    return TypedModelDetail::write(o, value, std::get<I>(properties).setter);
+  }
+
+  template <std::size_t... I>
+  static const std::array<Reader, sizeof...(I)>& readers(std::index_sequence<I...>)
+  {
+    static const std::array<Reader, sizeof...(I)> table {{ &TypedGenericListModel::readAt<I>... }};
+    return table;
+  }
+
+  template <std::size_t... I>
+  static const std::array<Writer, sizeof...(I)>& writers(std::index_sequence<I...>)
+  {
+    static const std::array<Writer, sizeof...(I)> table {{ &TypedGenericListModel::writeAt<I>... }};
+    return table;
+  }
+
+  template <std::size_t... I>
+  static const std::array<int, sizeof...(I)>& notifySignals(std::index_sequence<I...>)
+  {
+    constexpr auto properties = TypedModelTraits<T>::properties();
+    static const std::array<int, sizeof...(I)> table {{ TypedModelDetail::signalIndex(std::get<I>(properties).notify)... }};
+    Q_UNUSED(properties)
+    return table;
+  }
+
+  template <std::size_t... I>
+  static QHash<int, QByteArray> buildRoleNames(std::index_sequence<I...>)
+  {
+    constexpr auto properties = TypedModelTraits<T>::properties();
+    QHash<int, QByteArray> names;
+    names.insert(Qt::UserRole, "modelData");
+    (void)std::initializer_list<int>{ (names.insert(Qt::UserRole + 1 + static_cast<int>(I), std::get<I>(properties).name), 0)... };
+    Q_UNUSED(properties)
+    return names;
+  }
+
+  static const QHash<int, QByteArray>& roleNamesTable()
+  {
+    static const QHash<int, QByteArray> names = buildRoleNames(Indices{});
+    return names;
+  }
+
+  // The dispatcher id used for the destroyed signal, which follows the ids
+  // of all described properties.
+  static constexpr int destroyedId()
+  {
+    return propertyCount();
+  }
+
+  void connectElement(T* o)
+  {
+    const auto& signalIndices = notifySignals(Indices{});
+    for (int i = 0; i < propertyCount(); ++i)
+    {
+      if (signalIndices[i] >= 0)
+        m_dispatcher->connectSignal(o, signalIndices[i], i);
+    }
+
+    static const int destroyedIndex = QMetaMethod::fromSignal(&QObject::destroyed).methodIndex();
+    m_dispatcher->connectSignal(o, destroyedIndex, destroyedId());
+  }
+
+  void elementSignalled(QObject* sender, int id)
+  {
+    const int row = rowOf(sender);
+    if (row < 0)
+      return;
+
+    if (id == destroyedId())
+    {
+      m_rows.remove(sender);
+      m_objects[row] = nullptr; // Prevents double delete.
+      if (!m_removalScheduled)
+      {
+        m_removalScheduled = true;
+        QTimer::singleShot(0, this, [this]()
+        {
+          removeDestroyedRows();
+        });
+      }
+      return;
+    }
+
+    const int role = Qt::UserRole + 1 + id;
+    const auto i = index(row);
+    if (role == m_displayRole)
+      emit dataChanged(i, i, { Qt::UserRole, role, Qt::DisplayRole, Qt::EditRole });
+    else
+      emit dataChanged(i, i, { Qt::UserRole, role });
+  }
+
+  // Removes the rows emptied by elementSignalled, one contiguous run at a
+  // time, starting from the end of the list.
+  void removeDestroyedRows()
+  {
+    m_removalScheduled = false;
+
+    int last = m_objects.size() - 1;
+    while (last >= 0)
+    {
+      if (m_objects.at(last))
+      {
+        --last;
+        continue;
+      }
+
+      int first = last;
+      while (first > 0 && !m_objects.at(first - 1))
+        --first;
+
+      removeRows(first, last - first + 1);
+      last = first - 1;
+    }
+  }
+
+  // Rows before m_indexedRows are current in m_rows. A lookup which misses
+  // them renumbers the stale tail once, so a batch of changes shares a
+  // single renumbering pass.
+  int rowOf(const QObject* o) const
+  {
+    if (!o)
+      return -1;
+
+    const auto it = m_rows.constFind(o);
+    if (it != m_rows.cend() && it.value() < m_indexedRows)
+      return it.value();
+
+    const int size = m_objects.size();
+    if (m_indexedRows < size)
+    {
+      m_rows.reserve(size);
+      for (int i = m_indexedRows; i < size; ++i)
+      {
+        if (auto element = m_objects.at(i))
+          m_rows.insert(element, i);
+      }
+      m_indexedRows = size;
+    }
+    return m_rows.value(o, -1);
+  }
+
+private:
+  QVector<T*> m_objects;
+  SignalDispatcher* m_dispatcher = nullptr;
+  mutable QHash<const QObject*, int> m_rows;
+  mutable int m_indexedRows = 0;
+  bool m_removalScheduled = false;
+  int m_displayRole = -1;
+};
+
+} // Toolkit
+} // ArcGISRuntime
+} // Esri
+
+#endif // ESRI_ARCGISRUNTIME_TOOLKIT_INTERNAL_TYPEDGENERICLISTMODEL_H
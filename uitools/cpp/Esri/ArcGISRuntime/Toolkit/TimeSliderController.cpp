@@ -23,9 +23,8 @@
 #include <Scene.h>
 #include <TimeAware.h>
 
-#include <cmath>
-
 #include <QDebug>
+#include <QTimer>
 
 namespace Esri
 {
@@ -36,42 +35,36 @@ namespace Toolkit
 
 namespace
 {
+  // Signals of time-aware layers which change their contribution to the
+  // aggregate time extent and interval. Not every layer type has all of them.
+  constexpr const char* LAYER_TIME_SIGNALS[] = {
+    "fullTimeExtentChanged()",
+    "timeIntervalChanged()",
+    "timeFilteringEnabledChanged()"
+  };
+
   /*
    \internal
-   \brief Calls `std::accumlate` on a \c LayerListModel, but filters out
-          layers in the list-model that are not TimeAware.
-          The type \c T must be default-constructible.
-   \list
-   \li \a listModel ListModel to accummalate.
-   \li \a f Accumulation function that takes the current \c T and a \c TimeAware 
-       object.
-   \endlist 
-   Returns the accumulation of \c T.
+   \brief Returns whether \a a and \a b cover the same range.
    */
-  template <class T, class BinaryOperation>
-  T accumulateTimeAware(LayerListModel* listModel, BinaryOperation f)
+  bool sameTimeExtent(const TimeExtent& a, const TimeExtent& b)
   {
-    if (!listModel)
-      return T{};
-
-    return std::accumulate(
-      listModel->cbegin(),
-      listModel->cend(),
-      T{},
-      [f{std::move(f)}](const T& val, Layer* layer)
-      {
-        if (!layer || layer->loadStatus() != LoadStatus::Loaded)
-          return val;
-
-        auto timeAware = dynamic_cast<TimeAware*>(layer);
-        if (!timeAware || !timeAware->isTimeFilteringEnabled())
-          return val;
-
-        // TODO test for visible here.
-
-        return f(val, timeAware);
-      }
-    );
+    if (a.isEmpty() || b.isEmpty())
+      return a.isEmpty() == b.isEmpty();
+
+    return a.startTime() == b.startTime() && a.endTime() == b.endTime();
+  }
+
+  /*
+   \internal
+   \brief Returns whether \a a and \a b are the same interval in the same unit.
+   */
+  bool sameTimeValue(const TimeValue& a, const TimeValue& b)
+  {
+    if (a.isEmpty() || b.isEmpty())
+      return a.isEmpty() == b.isEmpty();
+
+    return a.unit() == b.unit() && a.duration() == b.duration();
   }
 
   /*
@@ -195,7 +188,9 @@ void TimeSliderController::setGeoView(QObject* geoView)
   if (geoView == m_geoView.data())
     return;
 
-  disconnect(this, nullptr, m_geoView.data(), nullptr);
+  if (m_geoView)
+    disconnect(m_geoView.data(), nullptr, this, nullptr);
+
   disconnectAllLayers();
 
   m_geoView = geoView;
@@ -229,12 +224,16 @@ void TimeSliderController::setGeoView(QObject* geoView)
  */
 void TimeSliderController::disconnectAllLayers()
 {
-  if (!m_operationalLayers)
-    return;
-
-  disconnect(m_operationalLayers, nullptr, this, nullptr);
-  for (const auto& layer : *m_operationalLayers)
+  for (const auto& layer : m_layers)
     disconnect(layer, nullptr, this, nullptr);
+
+  m_layers.clear();
+  m_layerTimes.clear();
+  m_pendingMerges.clear();
+  m_rescanPending = true;
+
+  if (m_operationalLayers)
+    disconnect(m_operationalLayers, nullptr, this, nullptr);
 }
 
 /*!
@@ -275,93 +274,331 @@ void TimeSliderController::initializeTimeProperties(LayerListModel* opLayers)
   m_operationalLayers = opLayers;
 
   if (!m_operationalLayers)
+  {
+    updateTimeProperties();
     return;
+  }
 
   connect(m_operationalLayers.data(), &LayerListModel::layerAdded,
-          this, qOverload<>(&TimeSliderController::initializeTimeProperties));
+          this, &TimeSliderController::layerAdded);
 
   connect(m_operationalLayers.data(), &LayerListModel::layerRemoved,
+          this, &TimeSliderController::layerRemoved);
+
+  // Changes not reported through layerAdded and layerRemoved invalidate the
+  // layer indices, so everything is tracked again.
+  connect(m_operationalLayers.data(), &LayerListModel::modelReset,
+          this, qOverload<>(&TimeSliderController::initializeTimeProperties));
+
+  connect(m_operationalLayers.data(), &LayerListModel::rowsMoved,
           this, qOverload<>(&TimeSliderController::initializeTimeProperties));
 
   for (const auto& layer : *m_operationalLayers)
   {
-    if (auto tLayer = dynamic_cast<TimeAware*>(layer))
-    {
-      connect(layer, &Layer::loadStatusChanged, 
-              this, qOverload<>(&TimeSliderController::initializeTimeProperties));
-    }
+    m_layers.append(layer);
+    trackLayer(layer);
   }
 
+  updateTimeAggregates();
   m_steps = stepsForGeoViewExtent();
   emit extentsChanged();
   emit stepsChanged();
 }
 
 /*!
- \brief Calculates the union of all extents of all \c TimeAware layers in the
+ \internal
+ \brief Starts tracking the layer added to the operational layers at
+ \a index, without touching any other layer.
+ */
+void TimeSliderController::layerAdded(int index)
+{
+  if (index < 0 || index > m_layers.size() || index >= m_operationalLayers->size())
+  {
+    initializeTimeProperties(m_operationalLayers);
+    return;
+  }
+
+  auto layer = m_operationalLayers->at(index);
+  m_layers.insert(index, layer);
+  trackLayer(layer);
+  layerTimeUpdated(layer, false);
+}
+
+/*!
+ \internal
+ \brief Stops tracking the layer removed from the operational layers at
+ \a index, without touching any other layer.
+ */
+void TimeSliderController::layerRemoved(int index)
+{
+  if (index < 0 || index >= m_layers.size())
+  {
+    initializeTimeProperties(m_operationalLayers);
+    return;
+  }
+
+  untrackLayer(m_layers.takeAt(index));
+}
+
+/*!
+ \internal
+ \brief Connects to the signals of \a layer which change its contribution to
+ \l fullTimeExtent and \l timeInterval, and records that contribution.
+
+ Layers which are not \c TimeAware are ignored.
+ */
+void TimeSliderController::trackLayer(Layer* layer)
+{
+  if (!layer || !dynamic_cast<TimeAware*>(layer))
+    return;
+
+  connect(layer, &Layer::loadStatusChanged,
+          this, &TimeSliderController::layerTimeChanged);
+
+  const auto metaObject = layer->metaObject();
+  const auto slot = staticMetaObject.method(staticMetaObject.indexOfSlot("layerTimeChanged()"));
+  for (const auto signature : LAYER_TIME_SIGNALS)
+  {
+    const int index = metaObject->indexOfSignal(signature);
+    if (index != -1)
+      connect(layer, metaObject->method(index), this, slot);
+  }
+
+  updateLayerTime(layer);
+}
+
+/*!
+ \internal
+ \brief Disconnects from \a layer and discards its contribution.
+ */
+void TimeSliderController::untrackLayer(Layer* layer)
+{
+  if (!layer)
+    return;
+
+  disconnect(layer, nullptr, this, nullptr);
+  m_pendingMerges.removeAll(layer);
+  if (m_layerTimes.remove(layer) > 0)
+  {
+    m_rescanPending = true;
+    scheduleTimeUpdate();
+  }
+}
+
+/*!
+ \internal
+ \brief Re-reads the contribution of the layer which emitted a tracked signal,
+ and updates the aggregate time properties if it changed.
+ */
+void TimeSliderController::layerTimeChanged()
+{
+  auto layer = qobject_cast<Layer*>(sender());
+  if (!layer)
+    return;
+
+  const bool wasContributing = m_layerTimes.contains(layer);
+  if (updateLayerTime(layer))
+    layerTimeUpdated(layer, wasContributing);
+}
+
+/*!
+ \internal
+ \brief Schedules the aggregates to be updated after the contribution of
+ \a layer changed.
+
+ A layer which starts contributing, as \a wasContributing tells, can only
+ widen the extent and shorten the interval, so it is merged into the
+ aggregates. Any other change may shrink them, which needs a rescan of the
+ recorded contributions.
+ */
+void TimeSliderController::layerTimeUpdated(Layer* layer, bool wasContributing)
+{
+  if (!m_layerTimes.contains(layer))
+  {
+    if (!wasContributing)
+      return;
+
+    m_rescanPending = true;
+  }
+  else if (wasContributing)
+  {
+    m_rescanPending = true;
+  }
+  else
+  {
+    m_pendingMerges.append(layer);
+  }
+
+  scheduleTimeUpdate();
+}
+
+/*!
+ \internal
+ \brief Updates the aggregates on the next turn of the event loop, so that
+ layers which change together, such as all the layers of a web map as it
+ loads, cause a single update.
+ */
+void TimeSliderController::scheduleTimeUpdate()
+{
+  if (m_updateScheduled)
+    return;
+
+  m_updateScheduled = true;
+  QTimer::singleShot(0, this, &TimeSliderController::updateTimeProperties);
+}
+
+/*!
+ \internal
+ \brief Applies the layer changes recorded since the last update, and
+ recomputes the steps if the aggregates changed.
+ */
+void TimeSliderController::updateTimeProperties()
+{
+  m_updateScheduled = false;
+  if (!updateTimeAggregates())
+    return;
+
+  m_steps = stepsForGeoViewExtent();
+  emit extentsChanged();
+  emit stepsChanged();
+}
+
+/*!
+ \internal
+ \brief Records the time extent and interval \a layer contributes, which is
+ none unless it is a loaded \c TimeAware layer with time filtering enabled.
+
+ Returns \c true if the contribution of \a layer changed.
+ */
+bool TimeSliderController::updateLayerTime(Layer* layer)
+{
+  auto timeAware = dynamic_cast<TimeAware*>(layer);
+  const bool contributes = timeAware && layer->loadStatus() == LoadStatus::Loaded &&
+                           timeAware->isTimeFilteringEnabled();
+
+  // TODO test for visible here.
+
+  auto it = m_layerTimes.find(layer);
+  if (!contributes)
+  {
+    if (it == m_layerTimes.end())
+      return false;
+
+    m_layerTimes.erase(it);
+    return true;
+  }
+
+  LayerTime layerTime;
+  layerTime.fullTimeExtent = timeAware->fullTimeExtent();
+  layerTime.timeInterval = timeAware->timeInterval();
+  if (it != m_layerTimes.end() &&
+      sameTimeExtent(it->fullTimeExtent, layerTime.fullTimeExtent) &&
+      sameTimeValue(it->timeInterval, layerTime.timeInterval))
+  {
+    return false;
+  }
+
+  m_layerTimes.insert(layer, layerTime);
+  return true;
+}
+
+/*!
+ \internal
+ \brief Widens the aggregate time extent, and shortens the aggregate interval,
+ to include \a layerTime.
+ */
+void TimeSliderController::mergeLayerTime(const LayerTime& layerTime)
+{
+  const auto& f = layerTime.fullTimeExtent;
+  if (m_fullTimeExtent.isEmpty())
+    m_fullTimeExtent = f;
+  else if (!f.isEmpty())
+    m_fullTimeExtent = TimeExtent{std::min(m_fullTimeExtent.startTime(), f.startTime()),
+                                  std::max(m_fullTimeExtent.endTime(), f.endTime())};
+
+  const auto& i = layerTime.timeInterval;
+  if (m_timeInterval.isEmpty())
+    m_timeInterval = i;
+  else if (!i.isEmpty())
+    m_timeInterval = minTimeValue(m_timeInterval, i);
+}
+
+/*!
+ \internal
+ \brief Updates the cached \l fullTimeExtent and \l timeInterval, and
+ rebuilds the step table if either changed.
+
+ If a contribution may have shrunk since the last update, the aggregates
+ are rebuilt from the recorded contribution of every layer. Otherwise only
+ the layers which started contributing are merged in. Layers themselves are
+ never queried.
+
+ Returns \c true if any of the cached values changed.
+ */
+bool TimeSliderController::updateTimeAggregates()
+{
+  const auto oldExtent = m_fullTimeExtent;
+  const auto oldInterval = m_timeInterval;
+  if (m_rescanPending)
+  {
+    m_fullTimeExtent = TimeExtent{};
+    m_timeInterval = TimeValue{};
+    for (const auto& layerTime : m_layerTimes)
+      mergeLayerTime(layerTime);
+  }
+  else
+  {
+    for (const auto& layer : m_pendingMerges)
+    {
+      const auto it = m_layerTimes.constFind(layer);
+      if (it != m_layerTimes.cend())
+        mergeLayerTime(*it);
+    }
+  }
+  m_rescanPending = false;
+  m_pendingMerges.clear();
+
+  if (sameTimeExtent(oldExtent, m_fullTimeExtent) && sameTimeValue(oldInterval, m_timeInterval))
+    return false;
+
+  m_stepTable.reset(m_fullTimeExtent, m_timeInterval);
+  return true;
+}
+
+/*!
+ \brief Returns the union of all extents of all \c TimeAware layers in the
  current \c GeoView.
+
+ The union is cached, and updated as layers load or change their time
+ properties.
  Returns a \c TimeExtent covering the combined range of all extents.
  */
 TimeExtent TimeSliderController::fullTimeExtent() const
 {
-  return accumulateTimeAware<TimeExtent>(
-    m_operationalLayers,
-    [](const TimeExtent& t, TimeAware* tLayer)
-    {
-      const auto f = tLayer->fullTimeExtent();
-      if (t.isEmpty())
-        return f;
-      else if (f.isEmpty())
-        return t;
-      else
-        return TimeExtent{std::min(t.startTime(), f.startTime()),
-                          std::max(t.endTime(), f.endTime())};
-    }
-  );
+  return m_fullTimeExtent;
 }
 
 /*!
- \brief Calculates the time-interval as a \c TimeValue, which is the smallest
+ \brief Returns the time-interval as a \c TimeValue, which is the smallest
   possible interval of all \c TimeAware layers in the current \c GeoView.
+
+ Like \l fullTimeExtent, the interval is cached.
  
  Returns a \c TimeValue which is the minimum time-interval of all intervals.
  */
 TimeValue TimeSliderController::timeInterval() const
 {
-  return accumulateTimeAware<TimeValue>(
-    m_operationalLayers,
-    [](const TimeValue& t, TimeAware* tLayer)
-    {
-      const auto f = tLayer->timeInterval();
-      if (t.isEmpty())
-        return f;
-      else if (f.isEmpty())
-        return t;
-      else
-        return minTimeValue(t, f);
-    }
-  );
+  return m_timeInterval;
 }
 
 /*!
- \brief Calculates the number of steps the TimeSlider should display based on 
+ \brief Returns the number of steps the TimeSlider should display based on 
  \l fullTimeExtent dividied by \l timeInterval.
  Returns number of steps for TimeSlider.
  */
 int TimeSliderController::numberOfSteps() const
 {
-  const auto extent = fullTimeExtent();
-  if (extent.isEmpty())
-    return 0;
-
-  const auto interval = timeInterval();
-  if (interval.isEmpty())
-    return 0;
-
-  const auto range = extent.startTime().msecsTo(extent.endTime());
-  const auto intervalMS = toMilliseconds(interval);
-
-  return std::ceil(range / intervalMS);
+  return m_stepTable.numberOfSteps();
 }
 
 /*!
@@ -429,6 +666,10 @@ void TimeSliderController::setSteps(std::pair<int, int> steps)
  Given \a step and \l numberOfSteps we can calculate the date-time for
  an arbitrary step \a step interpolated between the start and end times of 
  \l fullTimeExtent.
+
+ Steps of whole days or weeks advance by calendar days, and steps of whole
+ months, years, decades or centuries by calendar months, so they do not
+ drift over long extents.
  
  \list
  \li \a step Step to calculate a time for.
@@ -438,16 +679,7 @@ void TimeSliderController::setSteps(std::pair<int, int> steps)
  */
 QDateTime TimeSliderController::timeForStep(int step) const
 {
-  const auto extent = fullTimeExtent();
-  if (extent.isEmpty())
-    return QDateTime{};
-
-  const auto interval = timeInterval();
-  if (interval.isEmpty())
-    return QDateTime{};
-
-  const auto intervalMS = toMilliseconds(interval);
-  return extent.startTime().addMSecs(step * intervalMS);
+  return m_stepTable.timeForStep(step);
 }
 
 /*!
@@ -456,7 +688,8 @@ QDateTime TimeSliderController::timeForStep(int step) const
  current \c TimeExtent.
 
  When \c GeoView has an empty extent, this is equivalent to "show everything"
- and the steps returned are \c{[0, numberOfSteps()]} (inclusive).
+ and the steps returned are \c{[0, numberOfSteps()]} (inclusive). Otherwise
+ each end of the extent maps to the first step at or after it.
 
  Returns a pair of steps derived from the current \c GeoView time-extent.
  \sa TimeSliderController::timeForStep
@@ -468,29 +701,15 @@ std::pair<int, int> TimeSliderController::stepsForGeoViewExtent() const
   if (!geoView)
     return std::make_pair(0, 0);
 
-  const auto fullExtent = fullTimeExtent();
-  if (fullExtent.isEmpty())
-    return std::make_pair(0, 0);
-
-  const auto interval = timeInterval();
-  if (interval.isEmpty())
+  if (m_stepTable.isEmpty())
     return std::make_pair(0, 0);
 
-  const auto intervalMS = toMilliseconds(interval);
-
   const auto geoExtent = geoView->timeExtent();
   if (geoExtent.isEmpty())
-  {
-    auto range = fullExtent.startTime().msecsTo(fullExtent.endTime());
-    return std::make_pair(0, std::ceil(range / intervalMS));
-  }
-
-  const int s = std::ceil(fullExtent.startTime().msecsTo(
-                          geoExtent.startTime())  / intervalMS);
-  const int e = std::ceil(geoExtent.endTime().msecsTo(
-                          fullExtent.endTime()) / intervalMS);
+    return std::make_pair(0, m_stepTable.numberOfSteps());
 
-  return std::make_pair(s, e);
+  return std::make_pair(m_stepTable.stepForTime(geoExtent.startTime()),
+                        m_stepTable.stepForTime(geoExtent.endTime()));
 }
 
 /*!
@@ -16,11 +16,15 @@
 #ifndef ESRI_ARCGISRUNTIME_TOOLKIT_TIMESLIDERCONTROLLER_H
 #define ESRI_ARCGISRUNTIME_TOOLKIT_TIMESLIDERCONTROLLER_H
 
+// ArcGISRuntime Toolkit headers
+#include "Internal/TimeStepTable.h"
+
 // ArcGISRuntime headers
 #include <TimeExtent.h>
 #include <TimeValue.h>
 
 // Qt headers
+#include <QHash>
 #include <QObject>
 #include <QPointer>
 
@@ -30,6 +34,7 @@ namespace ArcGISRuntime
 {
 
 class GeoView;
+class Layer;
 class LayerListModel;
 class MapView;
 class SceneView;
@@ -76,16 +81,41 @@ signals:
 
 private slots:
     void initializeTimeProperties();
+    void layerAdded(int index);
+    void layerRemoved(int index);
+    void layerTimeChanged();
+    void updateTimeProperties();
 
 private:
+  struct LayerTime
+  {
+    TimeExtent fullTimeExtent;
+    TimeValue timeInterval;
+  };
+
   void initializeTimeProperties(LayerListModel* operationalLayers);
   void disconnectAllLayers();
+  void trackLayer(Layer* layer);
+  void untrackLayer(Layer* layer);
+  bool updateLayerTime(Layer* layer);
+  void layerTimeUpdated(Layer* layer, bool wasContributing);
+  void scheduleTimeUpdate();
+  void mergeLayerTime(const LayerTime& layerTime);
+  bool updateTimeAggregates();
   std::pair<int, int> stepsForGeoViewExtent() const;
 
 private:
   std::pair<int, int> m_steps {0, 0};
   QPointer<QObject> m_geoView = nullptr;
   QPointer<LayerListModel> m_operationalLayers;
+  QList<Layer*> m_layers;
+  QHash<Layer*, LayerTime> m_layerTimes;
+  QList<Layer*> m_pendingMerges;
+  bool m_rescanPending = false;
+  bool m_updateScheduled = false;
+  TimeExtent m_fullTimeExtent;
+  TimeValue m_timeInterval;
+  TimeStepTable m_stepTable;
 };
 
 } // Toolkit
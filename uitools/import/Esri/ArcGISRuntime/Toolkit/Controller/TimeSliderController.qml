@@ -407,18 +407,23 @@ QtObject {
             }
 
             const intervalMS = toMilliseconds(interval);
+            const startMS = extent.startTime.getTime();
+            const numberOfSteps = Math.ceil((extent.endTime.getTime() - startMS) / intervalMS);
             const geoExtent = geoView.timeExtent;
             const geoS = geoExtent ? geoExtent.startTime.getTime() : NaN;
             const geoE = geoExtent ? geoExtent.endTime.getTime() : NaN;
             if (!geoExtent || isNaN(geoS) || isNaN(geoE)) {
-              const r = extent.endTime.getTime() - extent.startTime.getTime();
-              return [0, Math.ceil(r / intervalMS)];
+              return [0, numberOfSteps];
             }
 
-            return [
-                Math.ceil((geoS - extent.startTime.getTime()) / intervalMS),
-                Math.ceil((extent.endTime.getTime() - geoE) / intervalMS)
-            ];
+            // Both ends are counted from the start of the full extent, as
+            // timeForStep does, and clamped to the steps of the full extent.
+            const stepForTime = function(time) {
+                const step = Math.ceil((time - startMS) / intervalMS);
+                return Math.min(Math.max(step, 0), numberOfSteps);
+            };
+
+            return [stepForTime(geoS), stepForTime(geoE)];
         }
     }
 }
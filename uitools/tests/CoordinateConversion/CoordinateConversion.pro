@@ -0,0 +1,54 @@
+###############################################################################
+# Copyright 2012-2020 Esri
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+###############################################################################
+
+TEMPLATE = app
+
+TARGET = tst_coordinateconversion
+
+include($$PWD/../common/common.pri)
+
+ARCGIS_RUNTIME_VERSION = 100.11
+include($$PWD/../common/arcgisruntime.pri)
+
+HEADERS += \
+    $$CPPPATH/CoordinateConversionConstants.h \
+    $$CPPPATH/CoordinateConversionOption.h \
+    $$CPPPATH/CoordinateConversionResult.h \
+    $$CPPPATH/CoordinateFormatSpec.h \
+    $$CPPPATH/CoordinateOptionDefaults.h \
+    $$CPPPATH/Internal/ElementTypeInfo.h \
+    $$CPPPATH/Internal/GenericListModel.h \
+    $$CPPPATH/Internal/GridReferenceFormatter.h \
+    $$CPPPATH/Internal/LatitudeLongitudeFormatter.h \
+    $$CPPPATH/Internal/NotationCache.h \
+    $$CPPPATH/Internal/NotationClassifier.h \
+    $$CPPPATH/Internal/SignalDispatcher.h \
+    $$CPPPATH/Internal/TypedGenericListModel.h
+
+SOURCES += \
+    tst_coordinateconversion.cpp \
+    $$CPPPATH/CoordinateConversionConstants.cpp \
+    $$CPPPATH/CoordinateConversionOption.cpp \
+    $$CPPPATH/CoordinateConversionResult.cpp \
+    $$CPPPATH/CoordinateFormatSpec.cpp \
+    $$CPPPATH/CoordinateOptionDefaults.cpp \
+    $$CPPPATH/Internal/ElementTypeInfo.cpp \
+    $$CPPPATH/Internal/GenericListModel.cpp \
+    $$CPPPATH/Internal/GridReferenceFormatter.cpp \
+    $$CPPPATH/Internal/LatitudeLongitudeFormatter.cpp \
+    $$CPPPATH/Internal/NotationCache.cpp \
+    $$CPPPATH/Internal/NotationClassifier.cpp \
+    $$CPPPATH/Internal/SignalDispatcher.cpp
@@ -0,0 +1,894 @@
+/*******************************************************************************
+ *  Copyright 2012-2020 Esri
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+#include "TestMain.h"
+
+// Toolkit headers
+#include "CoordinateConversionResult.h"
+#include "CoordinateOptionDefaults.h"
+#include "Internal/GenericListModel.h"
+#include "Internal/GridReferenceFormatter.h"
+#include "Internal/LatitudeLongitudeFormatter.h"
+#include "Internal/NotationClassifier.h"
+#include "Internal/TypedGenericListModel.h"
+
+// Qt headers
+#include <QSignalSpy>
+#include <QtTest>
+
+// ArcGISRuntime headers
+#include <CoordinateFormatter.h>
+#include <SpatialReference.h>
+
+// std headers
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace Esri
+{
+namespace ArcGISRuntime
+{
+namespace Toolkit
+{
+
+// Describes the properties of a CoordinateConversionResult, in declaration
+// order, so results can be held by a TypedGenericListModel.
+template <>
+struct TypedModelTraits<CoordinateConversionResult>
+{
+  static constexpr auto properties()
+  {
+    return std::make_tuple(
+      typedProperty("name", &CoordinateConversionResult::name, nullptr,
+                    &CoordinateConversionResult::nameChanged),
+      typedProperty("notation", &CoordinateConversionResult::notation,
+                    &CoordinateConversionResult::setNotation,
+                    &CoordinateConversionResult::notationChanged),
+      typedProperty("type", &CoordinateConversionResult::type,
+                    &CoordinateConversionResult::setType,
+                    &CoordinateConversionResult::typeChanged));
+  }
+};
+
+} // Toolkit
+} // ArcGISRuntime
+} // Esri
+
+using namespace Esri::ArcGISRuntime;
+using namespace Esri::ArcGISRuntime::Toolkit;
+
+namespace
+{
+
+// Rows held by the result models while they are read.
+constexpr int ResultRows = 10000;
+
+using TypedResultModel = TypedGenericListModel<CoordinateConversionResult>;
+
+// Latitude and longitude pairs, in degrees.
+using Coordinates = std::vector<std::pair<double, double>>;
+
+// Steps along each axis of the grid of points the formatters are checked on.
+// Prime, so the grid does not line up with any printed unit.
+constexpr int GridSteps = 251;
+
+// Steps along each axis of the grid of points formatting is timed on, which
+// holds a million points.
+constexpr int ThroughputGridSteps = 999;
+
+// Steps of the finer grids over the Norway and Svalbard zone exceptions.
+constexpr int ExceptionGridSteps = 61;
+
+// The grid reference formatter checked by a gridReferenceFormatter row.
+enum GridKind
+{
+  Utm,
+  Mgrs,
+  Usng
+};
+
+// Appends a \a steps + 1 square grid of points spanning the given latitudes
+// and longitudes to \a coordinates.
+void appendGrid(Coordinates& coordinates, double minLatitude, double maxLatitude,
+                double minLongitude, double maxLongitude, int steps = GridSteps)
+{
+  for (int i = 0; i <= steps; ++i)
+  {
+    const double latitude = minLatitude + (maxLatitude - minLatitude) * i / steps;
+    for (int j = 0; j <= steps; ++j)
+      coordinates.emplace_back(latitude, minLongitude + (maxLongitude - minLongitude) * j / steps);
+  }
+}
+
+// Appends points a hair either side of \a longitude, which is the edge of a
+// UTM zone, from \a minLatitude to \a maxLatitude in steps of \a step.
+void appendZoneEdge(Coordinates& coordinates, double longitude,
+                    double minLatitude, double maxLatitude, double step)
+{
+  for (double latitude = minLatitude; latitude <= maxLatitude; latitude += step)
+  {
+    for (double offset : { -1e-7, -1e-9, 0.0, 1e-9, 1e-7 })
+      coordinates.emplace_back(latitude, longitude + offset);
+  }
+}
+
+// Returns the points grid references are checked on. Besides a grid over the
+// area covered by UTM, these are concentrated where the zone, band and 100km
+// square letters change.
+const Coordinates& gridReferenceCorpus()
+{
+  static const Coordinates corpus = []()
+  {
+    Coordinates coordinates;
+    appendGrid(coordinates, -80.0, 84.0, -180.0, 180.0);
+
+    // Every regular zone edge, and those of 32V and 31X to 37X.
+    for (int zone = 1; zone < 60; ++zone)
+      appendZoneEdge(coordinates, -180.0 + 6.0 * zone, -80.0, 84.0, 2.0);
+
+    for (double longitude : { 3.0, 12.0 })
+      appendZoneEdge(coordinates, longitude, 56.0, 64.0, 0.05);
+
+    for (double longitude : { 9.0, 21.0, 33.0, 42.0 })
+      appendZoneEdge(coordinates, longitude, 72.0, 84.0, 0.05);
+
+    // Both sides of every band edge, and the 12 degree tall band X.
+    for (int band = 0; band <= 20; ++band)
+    {
+      const double latitude = band == 20 ? 84.0 : -80.0 + 8.0 * band;
+      for (double offset : { -1e-7, -1e-9, 0.0, 1e-9, 1e-7 })
+      {
+        for (double longitude = -178.5; longitude < 180.0; longitude += 3.0)
+          coordinates.emplace_back(latitude + offset, longitude);
+      }
+    }
+    appendGrid(coordinates, 72.0, 84.0, 0.0, 42.0, ExceptionGridSteps);
+    appendGrid(coordinates, 56.0, 64.0, 0.0, 12.0, ExceptionGridSteps);
+
+    // The row letters wrap every 2000km of northing and the column letters
+    // every three zones. Meridians through three neighbouring zones, sampled
+    // at well under 100km, see every letter of every set and each wrap.
+    for (double longitude : { 0.001, 1.5, 3.0, 5.999, 6.001, 9.0, 11.999, 12.001, 15.0, 17.999 })
+    {
+      for (double latitude = -80.0; latitude < 84.0; latitude += 0.05)
+        coordinates.emplace_back(latitude, longitude);
+    }
+
+    // And parallels across one zone, for the column letters and eastings.
+    for (double latitude : { -79.9, -45.0, -0.001, 0.0, 0.001, 45.0, 83.9 })
+    {
+      for (double longitude = 0.0; longitude < 6.0; longitude += 0.01)
+        coordinates.emplace_back(latitude, longitude);
+    }
+
+    coordinates.erase(std::remove_if(coordinates.begin(), coordinates.end(),
+                                     [](const std::pair<double, double>& coordinate)
+                                     {
+                                       return !GridReferenceFormatter::canFormat(coordinate.first, coordinate.second);
+                                     }),
+                      coordinates.end());
+    return coordinates;
+  }();
+  return corpus;
+}
+
+// Appends the values either side of, and exactly at, the rounding threshold
+// of the smallest printed unit below \a boundary, for both signs. Rounding
+// these up carries into every larger unit that \a boundary is a whole
+// number of.
+void appendCarries(std::vector<double>& values, double boundary, double unitsPerDegree)
+{
+  const double half = 0.5 / unitsPerDegree;
+  for (double offset : { 0.98 * half, half, 1.02 * half })
+  {
+    values.push_back(boundary - offset);
+    values.push_back(-(boundary - offset));
+  }
+}
+
+}
+
+class tst_CoordinateConversion : public QObject
+{
+  Q_OBJECT
+
+private slots:
+  void typedResultModelMatchesGeneric();
+  void typedResultModelInsertRows();
+
+  void resultModelAppend_data();
+  void resultModelAppend();
+
+  void resultModelData_data();
+  void resultModelData();
+
+  void resultModelElement_data();
+  void resultModelElement();
+
+  void resultModelDestroy_data();
+  void resultModelDestroy();
+
+  void latitudeLongitudeFormatter_data();
+  void latitudeLongitudeFormatter();
+
+  void latitudeLongitudeThroughput_data();
+  void latitudeLongitudeThroughput();
+
+  void gridReferenceFormatter_data();
+  void gridReferenceFormatter();
+
+  void gridReferenceThroughput_data();
+  void gridReferenceThroughput();
+
+  void notationClassification_data();
+  void notationClassification();
+
+  void notationClassifier_data();
+  void notationClassifier();
+
+private:
+  static QList<CoordinateConversionResult*> createResults(int count, CoordinateConversionOption* option,
+                                                          QObject* parent);
+
+  static std::unique_ptr<QAbstractListModel> createResultModel(bool typed,
+                                                               const QList<CoordinateConversionResult*>& results);
+};
+
+void tst_CoordinateConversion::typedResultModelMatchesGeneric()
+{
+  QObject owner;
+  auto option = createMgrs(MgrsConversionMode::Automatic, &owner);
+  const auto results = createResults(100, option, &owner);
+
+  auto typed = createResultModel(true, results);
+  auto generic = createResultModel(false, results);
+  static_cast<TypedResultModel*>(typed.get())->setDisplayPropertyName("notation");
+  static_cast<GenericListModel*>(generic.get())->setDisplayPropertyName("notation");
+
+  const auto roles = generic->roleNames();
+  QCOMPARE(typed->roleNames(), roles);
+
+  auto allRoles = roles.keys();
+  allRoles << Qt::DisplayRole << Qt::EditRole;
+  for (int row = 0; row < results.size(); ++row)
+  {
+    for (int role : allRoles)
+      QCOMPARE(typed->data(typed->index(row), role), generic->data(generic->index(row), role));
+  }
+}
+
+void tst_CoordinateConversion::typedResultModelInsertRows()
+{
+  TypedResultModel model;
+  QVERIFY(model.insertRows(0, 3));
+  QVERIFY(model.insertRows(1, 2));
+  QVERIFY(!model.insertRows(6, 1));
+  QCOMPARE(model.rowCount(), 5);
+
+  for (int row = 0; row < model.rowCount(); ++row)
+  {
+    QVERIFY(model.at(row));
+    QCOMPARE(model.at(row)->parent(), &model);
+  }
+
+  // Notifications resolve to the element's row after a mid-list insertion.
+  QSignalSpy spy(&model, &QAbstractItemModel::dataChanged);
+  model.at(3)->setNotation("31U DQ 48251 11932");
+  QCOMPARE(spy.count(), 1);
+  QCOMPARE(spy.at(0).at(0).value<QModelIndex>().row(), 3);
+  QCOMPARE(model.data(model.index(3), Qt::UserRole + 2).toString(), QString("31U DQ 48251 11932"));
+
+  // Deleting an element externally empties its row, then removes it.
+  delete model.at(1);
+  QVERIFY(!model.at(1));
+  QTRY_COMPARE(model.rowCount(), 4);
+
+  // Rows after the removed one still resolve to their new row.
+  spy.clear();
+  model.at(3)->setNotation("31U DQ 48251 11933");
+  QCOMPARE(spy.count(), 1);
+  QCOMPARE(spy.at(0).at(0).value<QModelIndex>().row(), 3);
+}
+
+void tst_CoordinateConversion::resultModelAppend_data()
+{
+  QTest::addColumn<bool>("typed");
+
+  QTest::newRow("generic") << false;
+  QTest::newRow("typed") << true;
+}
+
+void tst_CoordinateConversion::resultModelAppend()
+{
+  QFETCH(bool, typed);
+
+  QObject owner;
+  auto option = createMgrs(MgrsConversionMode::Automatic, &owner);
+  const auto results = createResults(ResultRows, option, &owner);
+
+  QBENCHMARK
+  {
+    auto model = createResultModel(typed, results);
+    QCOMPARE(model->rowCount(), ResultRows);
+  }
+}
+
+void tst_CoordinateConversion::resultModelData_data()
+{
+  QTest::addColumn<bool>("typed");
+  QTest::addColumn<int>("role");
+
+  const auto roles = TypedResultModel().roleNames();
+  for (auto it = roles.cbegin(); it != roles.cend(); ++it)
+  {
+    QTest::newRow(("generic " + it.value()).constData()) << false << it.key();
+    QTest::newRow(("typed " + it.value()).constData()) << true << it.key();
+  }
+}
+
+void tst_CoordinateConversion::resultModelData()
+{
+  QFETCH(bool, typed);
+  QFETCH(int, role);
+
+  QObject owner;
+  auto option = createMgrs(MgrsConversionMode::Automatic, &owner);
+  const auto results = createResults(ResultRows, option, &owner);
+  auto model = createResultModel(typed, results);
+
+  QBENCHMARK
+  {
+    for (int row = 0; row < ResultRows; ++row)
+      model->data(model->index(row), role);
+  }
+}
+
+void tst_CoordinateConversion::resultModelElement_data()
+{
+  resultModelAppend_data();
+}
+
+void tst_CoordinateConversion::resultModelElement()
+{
+  QFETCH(bool, typed);
+
+  QObject owner;
+  auto option = createMgrs(MgrsConversionMode::Automatic, &owner);
+  const auto results = createResults(ResultRows, option, &owner);
+  auto model = createResultModel(typed, results);
+
+  if (typed)
+  {
+    auto typedModel = static_cast<TypedResultModel*>(model.get());
+    QBENCHMARK
+    {
+      for (int row = 0; row < ResultRows; ++row)
+        QVERIFY(typedModel->element(typedModel->index(row)));
+    }
+  }
+  else
+  {
+    auto genericModel = static_cast<GenericListModel*>(model.get());
+    QBENCHMARK
+    {
+      for (int row = 0; row < ResultRows; ++row)
+        QVERIFY(genericModel->element<CoordinateConversionResult>(genericModel->index(row)));
+    }
+  }
+}
+
+void tst_CoordinateConversion::resultModelDestroy_data()
+{
+  resultModelAppend_data();
+}
+
+void tst_CoordinateConversion::resultModelDestroy()
+{
+  QFETCH(bool, typed);
+
+  // Deletes every other result elsewhere, front to back, then lets the model
+  // catch up. Each deletion looks up its row, so this measures how often the
+  // row index is renumbered.
+  QBENCHMARK
+  {
+    QObject owner;
+    auto option = createMgrs(MgrsConversionMode::Automatic, &owner);
+    const auto results = createResults(ResultRows, option, &owner);
+    auto model = createResultModel(typed, results);
+
+    for (int i = 0; i < ResultRows; i += 2)
+      delete results.at(i);
+
+    QTRY_COMPARE(model->rowCount(), ResultRows / 2);
+  }
+}
+
+void tst_CoordinateConversion::latitudeLongitudeFormatter_data()
+{
+  QTest::addColumn<int>("format");
+  QTest::addColumn<int>("decimalPlaces");
+
+  const std::pair<LatitudeLongitudeFormat, const char*> formats[] =
+  {
+    { LatitudeLongitudeFormat::DecimalDegrees, "DD" },
+    { LatitudeLongitudeFormat::DegreesDecimalMinutes, "DDM" },
+    { LatitudeLongitudeFormat::DegreesMinutesSeconds, "DMS" }
+  };
+
+  for (const auto& format : formats)
+  {
+    for (int decimalPlaces : { 0, 1, 2, 3, 4, 6, 8 })
+    {
+      QTest::addRow("%s %d", format.second, decimalPlaces)
+          << static_cast<int>(format.first) << decimalPlaces;
+    }
+  }
+}
+
+void tst_CoordinateConversion::latitudeLongitudeFormatter()
+{
+  QFETCH(int, format);
+  QFETCH(int, decimalPlaces);
+
+  const auto latLonFormat = static_cast<LatitudeLongitudeFormat>(format);
+  const LatitudeLongitudeFormatter formatter(latLonFormat, decimalPlaces);
+  QVERIFY(formatter.isSupported());
+
+  double unitsPerDegree = std::pow(10.0, decimalPlaces);
+  if (latLonFormat == LatitudeLongitudeFormat::DegreesDecimalMinutes)
+    unitsPerDegree *= 60.0;
+  else if (latLonFormat == LatitudeLongitudeFormat::DegreesMinutesSeconds)
+    unitsPerDegree *= 3600.0;
+
+  Coordinates coordinates;
+  appendGrid(coordinates, -90.0, 90.0, -180.0, 180.0);
+
+  // Values just short of whole degrees, minutes and seconds, including the
+  // widths at which the degrees gain a digit.
+  std::vector<double> carries;
+  for (double degrees : { 0.0, 1.0, 9.0, 10.0, 45.0, 89.0, 90.0, 99.0, 100.0, 179.0, 180.0 })
+  {
+    appendCarries(carries, degrees, unitsPerDegree);
+    appendCarries(carries, degrees + 1.0 / 60.0, unitsPerDegree);
+    appendCarries(carries, degrees + 59.0 / 60.0, unitsPerDegree);
+    appendCarries(carries, degrees + 1.0 / 3600.0, unitsPerDegree);
+    appendCarries(carries, degrees + 59.0 / 60.0 + 59.0 / 3600.0, unitsPerDegree);
+  }
+  // Each value is paired with itself where it is a valid latitude, so it is
+  // checked as both, and with half of itself otherwise.
+  for (double value : carries)
+  {
+    const double latitude = std::abs(value) <= 90.0 ? value : value / 2.0;
+    coordinates.emplace_back(latitude, value);
+  }
+
+  const int count = static_cast<int>(coordinates.size());
+  std::vector<double> latitudes;
+  std::vector<double> longitudes;
+  latitudes.reserve(count);
+  longitudes.reserve(count);
+  for (const auto& coordinate : coordinates)
+  {
+    latitudes.push_back(coordinate.first);
+    longitudes.push_back(coordinate.second);
+  }
+
+  std::vector<QString> batch(count);
+  formatter.format(latitudes.data(), longitudes.data(), count, batch.data());
+
+  const auto wgs84 = SpatialReference::wgs84();
+  for (int i = 0; i < count; ++i)
+  {
+    const Point point(longitudes[i], latitudes[i], wgs84);
+    const auto expected = CoordinateFormatter::toLatitudeLongitude(point, latLonFormat, decimalPlaces);
+    const auto single = formatter.format(latitudes[i], longitudes[i]);
+    if (single != expected || batch[i] != expected)
+    {
+      QFAIL(qPrintable(QString("%1, %2: expected \"%3\", formatted \"%4\" and \"%5\"")
+                       .arg(latitudes[i], 0, 'g', 17).arg(longitudes[i], 0, 'g', 17)
+                       .arg(expected, single, batch[i])));
+    }
+  }
+}
+
+void tst_CoordinateConversion::latitudeLongitudeThroughput_data()
+{
+  QTest::addColumn<int>("format");
+  QTest::addColumn<bool>("native");
+
+  const std::pair<LatitudeLongitudeFormat, const char*> formats[] =
+  {
+    { LatitudeLongitudeFormat::DecimalDegrees, "DD" },
+    { LatitudeLongitudeFormat::DegreesDecimalMinutes, "DDM" },
+    { LatitudeLongitudeFormat::DegreesMinutesSeconds, "DMS" }
+  };
+
+  for (const auto& format : formats)
+  {
+    QTest::addRow("%s toolkit", format.second) << static_cast<int>(format.first) << true;
+    QTest::addRow("%s runtime", format.second) << static_cast<int>(format.first) << false;
+  }
+}
+
+void tst_CoordinateConversion::latitudeLongitudeThroughput()
+{
+  QFETCH(int, format);
+  QFETCH(bool, native);
+
+  constexpr int decimalPlaces = 6;
+  const auto latLonFormat = static_cast<LatitudeLongitudeFormat>(format);
+
+  Coordinates coordinates;
+  appendGrid(coordinates, -90.0, 90.0, -180.0, 180.0, ThroughputGridSteps);
+  const int count = static_cast<int>(coordinates.size());
+
+  std::vector<QString> notations(count);
+  if (native)
+  {
+    const LatitudeLongitudeFormatter formatter(latLonFormat, decimalPlaces);
+    QVERIFY(formatter.isSupported());
+
+    std::vector<double> latitudes;
+    std::vector<double> longitudes;
+    latitudes.reserve(count);
+    longitudes.reserve(count);
+    for (const auto& coordinate : coordinates)
+    {
+      latitudes.push_back(coordinate.first);
+      longitudes.push_back(coordinate.second);
+    }
+
+    QBENCHMARK
+    {
+      formatter.format(latitudes.data(), longitudes.data(), count, notations.data());
+    }
+  }
+  else
+  {
+    const auto wgs84 = SpatialReference::wgs84();
+    std::vector<Point> points;
+    points.reserve(count);
+    for (const auto& coordinate : coordinates)
+      points.emplace_back(coordinate.second, coordinate.first, wgs84);
+
+    QBENCHMARK
+    {
+      for (int i = 0; i < count; ++i)
+        notations[i] = CoordinateFormatter::toLatitudeLongitude(points[i], latLonFormat, decimalPlaces);
+    }
+  }
+
+  QVERIFY(!notations.back().isEmpty());
+}
+
+void tst_CoordinateConversion::gridReferenceFormatter_data()
+{
+  QTest::addColumn<int>("kind");
+  QTest::addColumn<int>("mode");
+  QTest::addColumn<int>("precision");
+  QTest::addColumn<bool>("addSpaces");
+
+  const std::pair<UtmConversionMode, const char*> utmModes[] =
+  {
+    { UtmConversionMode::LatitudeBandIndicators, "bands" },
+    { UtmConversionMode::NorthSouthIndicators, "north/south" }
+  };
+  for (const auto& mode : utmModes)
+  {
+    for (bool addSpaces : { false, true })
+    {
+      QTest::addRow("UTM %s%s", mode.second, addSpaces ? " spaced" : "")
+          << static_cast<int>(Utm) << static_cast<int>(mode.first) << 0 << addSpaces;
+    }
+  }
+
+  const std::pair<MgrsConversionMode, const char*> mgrsModes[] =
+  {
+    { MgrsConversionMode::Automatic, "automatic" },
+    { MgrsConversionMode::New180InZone01, "new 01" },
+    { MgrsConversionMode::New180InZone60, "new 60" },
+    { MgrsConversionMode::Old180InZone01, "old 01" },
+    { MgrsConversionMode::Old180InZone60, "old 60" }
+  };
+  for (const auto& mode : mgrsModes)
+  {
+    for (int precision : { 0, 1, 2, 5, 8 })
+    {
+      QTest::addRow("MGRS %s %d", mode.second, precision)
+          << static_cast<int>(Mgrs) << static_cast<int>(mode.first) << precision << true;
+    }
+  }
+  QTest::addRow("MGRS automatic 5 unspaced")
+      << static_cast<int>(Mgrs) << static_cast<int>(MgrsConversionMode::Automatic) << 5 << false;
+
+  for (int precision : { 0, 1, 2, 5, 8 })
+  {
+    for (bool addSpaces : { false, true })
+    {
+      QTest::addRow("USNG %d%s", precision, addSpaces ? " spaced" : "")
+          << static_cast<int>(Usng) << 0 << precision << addSpaces;
+    }
+  }
+}
+
+void tst_CoordinateConversion::gridReferenceFormatter()
+{
+  QFETCH(int, kind);
+  QFETCH(int, mode);
+  QFETCH(int, precision);
+  QFETCH(bool, addSpaces);
+
+  const auto utmMode = static_cast<UtmConversionMode>(mode);
+  const auto mgrsMode = static_cast<MgrsConversionMode>(mode);
+  const auto formatter = kind == Utm ? GridReferenceFormatter::utm(utmMode, addSpaces)
+                       : kind == Mgrs ? GridReferenceFormatter::mgrs(mgrsMode, precision, addSpaces)
+                                      : GridReferenceFormatter::usng(precision, addSpaces);
+  QVERIFY(formatter.isSupported());
+
+  const auto& corpus = gridReferenceCorpus();
+  const int count = static_cast<int>(corpus.size());
+  std::vector<double> latitudes;
+  std::vector<double> longitudes;
+  latitudes.reserve(count);
+  longitudes.reserve(count);
+  for (const auto& coordinate : corpus)
+  {
+    latitudes.push_back(coordinate.first);
+    longitudes.push_back(coordinate.second);
+  }
+
+  std::vector<QString> batch(count);
+  formatter.format(latitudes.data(), longitudes.data(), count, batch.data());
+
+  const auto wgs84 = SpatialReference::wgs84();
+  for (int i = 0; i < count; ++i)
+  {
+    const Point point(longitudes[i], latitudes[i], wgs84);
+    const auto expected = kind == Utm ? CoordinateFormatter::toUtm(point, utmMode, addSpaces)
+                        : kind == Mgrs ? CoordinateFormatter::toMgrs(point, mgrsMode, precision, addSpaces)
+                                       : CoordinateFormatter::toUsng(point, precision, addSpaces);
+    const auto single = formatter.format(latitudes[i], longitudes[i]);
+    if (single != expected || batch[i] != expected)
+    {
+      QFAIL(qPrintable(QString("%1, %2: expected \"%3\", formatted \"%4\" and \"%5\"")
+                       .arg(latitudes[i], 0, 'g', 17).arg(longitudes[i], 0, 'g', 17)
+                       .arg(expected, single, batch[i])));
+    }
+  }
+}
+
+void tst_CoordinateConversion::gridReferenceThroughput_data()
+{
+  QTest::addColumn<int>("kind");
+  QTest::addColumn<bool>("native");
+
+  QTest::newRow("UTM toolkit") << static_cast<int>(Utm) << true;
+  QTest::newRow("UTM runtime") << static_cast<int>(Utm) << false;
+  QTest::newRow("MGRS toolkit") << static_cast<int>(Mgrs) << true;
+  QTest::newRow("MGRS runtime") << static_cast<int>(Mgrs) << false;
+  QTest::newRow("USNG toolkit") << static_cast<int>(Usng) << true;
+  QTest::newRow("USNG runtime") << static_cast<int>(Usng) << false;
+}
+
+void tst_CoordinateConversion::gridReferenceThroughput()
+{
+  QFETCH(int, kind);
+  QFETCH(bool, native);
+
+  constexpr int precision = 5;
+  const auto utmMode = UtmConversionMode::LatitudeBandIndicators;
+  const auto mgrsMode = MgrsConversionMode::Automatic;
+
+  const auto& corpus = gridReferenceCorpus();
+  const int count = static_cast<int>(corpus.size());
+
+  std::vector<QString> notations(count);
+  if (native)
+  {
+    const auto formatter = kind == Utm ? GridReferenceFormatter::utm(utmMode, true)
+                         : kind == Mgrs ? GridReferenceFormatter::mgrs(mgrsMode, precision, true)
+                                        : GridReferenceFormatter::usng(precision, true);
+    QVERIFY(formatter.isSupported());
+
+    std::vector<double> latitudes;
+    std::vector<double> longitudes;
+    latitudes.reserve(count);
+    longitudes.reserve(count);
+    for (const auto& coordinate : corpus)
+    {
+      latitudes.push_back(coordinate.first);
+      longitudes.push_back(coordinate.second);
+    }
+
+    QBENCHMARK
+    {
+      formatter.format(latitudes.data(), longitudes.data(), count, notations.data());
+    }
+  }
+  else
+  {
+    const auto wgs84 = SpatialReference::wgs84();
+    std::vector<Point> points;
+    points.reserve(count);
+    for (const auto& coordinate : corpus)
+      points.emplace_back(coordinate.second, coordinate.first, wgs84);
+
+    QBENCHMARK
+    {
+      for (int i = 0; i < count; ++i)
+      {
+        notations[i] = kind == Utm ? CoordinateFormatter::toUtm(points[i], utmMode, true)
+                     : kind == Mgrs ? CoordinateFormatter::toMgrs(points[i], mgrsMode, precision, true)
+                                    : CoordinateFormatter::toUsng(points[i], precision, true);
+      }
+    }
+  }
+
+  QVERIFY(!notations.back().isEmpty());
+}
+
+void tst_CoordinateConversion::notationClassification_data()
+{
+  using CoordinateType = NotationClassifier::CoordinateType;
+
+  QTest::addColumn<QString>("text");
+  QTest::addColumn<QList<int>>("types");
+
+  const QList<int> grid { CoordinateType::Mgrs, CoordinateType::Usng };
+  const QList<int> gars { CoordinateType::Gars };
+  const QList<int> geoRef { CoordinateType::GeoRef };
+  const QList<int> latLon { CoordinateType::LatLon };
+  const QList<int> utm { CoordinateType::Utm };
+
+  QTest::newRow("UTM") << "33N 344383 6173342" << utm;
+  QTest::newRow("UTM band") << "33U 344383 6173342" << utm;
+  // Within about 10km of the equator the northing has fewer than 5 digits.
+  QTest::newRow("UTM near equator") << "31N 500000 1234" << utm;
+  QTest::newRow("UTM on equator") << "31N 166021 0" << utm;
+  QTest::newRow("UTM south near equator") << "32S 500000 9999" << utm;
+
+  QTest::newRow("MGRS") << "33U UB 44383 38342" << grid;
+  QTest::newRow("MGRS unspaced") << "33UUB4438338342" << grid;
+  QTest::newRow("UPS") << "ZGC 12345 67890" << grid;
+  QTest::newRow("UPS square") << "A TN" << grid;
+
+  QTest::newRow("GARS") << "384LZ13" << gars;
+  QTest::newRow("GARS cell") << "384LZ" << gars;
+
+  QTest::newRow("GeoRef") << "PJAK1234" << geoRef;
+  QTest::newRow("GeoRef square") << "PJAK" << geoRef;
+
+  QTest::newRow("DD hemispheres") << "55.6761N 12.5683E" << latLon;
+  QTest::newRow("DD signed") << "-33.865143, 151.2099" << latLon;
+  QTest::newRow("DD plus and minus") << "+40.5 -74.25" << latLon;
+  QTest::newRow("DMS signed") << "-45 30 15.5, -120 15 30" << latLon;
+  QTest::newRow("DMS symbols") << "40°41'21.3\"N 74°02'40.2\"W" << latLon;
+
+  QTest::newRow("place name") << "Copenhagen" << QList<int>();
+  QTest::newRow("words") << "hello world" << QList<int>();
+  QTest::newRow("blank") << "   " << QList<int>();
+  QTest::newRow("empty") << "" << QList<int>();
+}
+
+void tst_CoordinateConversion::notationClassification()
+{
+  QFETCH(QString, text);
+  QFETCH(QList<int>, types);
+
+  QList<int> classified;
+  for (auto type : NotationClassifier::classify(text))
+    classified.append(type);
+
+  QCOMPARE(classified, types);
+}
+
+void tst_CoordinateConversion::notationClassifier_data()
+{
+  QTest::addColumn<QStringList>("texts");
+
+  // Text as typed into a search box: every notation, with and without
+  // spaces, part-typed references, and text in no notation at all.
+  const QStringList mixed
+  {
+    "55.6761N 12.5683E",
+    "55 40.566N 012 34.100E",
+    "55 40 33.95N 012 34 06.01E",
+    "-33.865143, 151.2099",
+    "40°41'21.3\"N 74°02'40.2\"W",
+    "33U UB 44383 38342",
+    "33UUB4438338342",
+    "18T WL 8",
+    "33U 344383 6173342",
+    "33N 344383 6173342",
+    "384LZ13",
+    "PJAK1234",
+    "Copenhagen",
+    "12345",
+    ""
+  };
+
+  QTest::newRow("mixed") << mixed;
+
+  // Grid references alone, which match the most patterns.
+  QStringList grid;
+  for (int i = 0; i < mixed.size(); ++i)
+  {
+    grid << QString("%1U UB %2 %3").arg(1 + i % 60)
+                                  .arg(i * 977 % 100000, 5, 10, QChar('0'))
+                                  .arg(i * 7919 % 100000, 5, 10, QChar('0'));
+  }
+  QTest::newRow("grid") << grid;
+}
+
+void tst_CoordinateConversion::notationClassifier()
+{
+  QFETCH(QStringList, texts);
+
+  // Classifying is done on every keystroke, so report per pass over the
+  // inputs after the patterns are compiled.
+  NotationClassifier::classify(texts.first());
+
+  int matches = 0;
+  QBENCHMARK
+  {
+    for (const auto& text : texts)
+      matches += NotationClassifier::classify(text).size();
+  }
+  QVERIFY(matches > 0);
+}
+
+QList<CoordinateConversionResult*> tst_CoordinateConversion::createResults(
+  int count, CoordinateConversionOption* option, QObject* parent)
+{
+  QList<CoordinateConversionResult*> results;
+  results.reserve(count);
+  for (int i = 0; i < count; ++i)
+  {
+    auto result = new CoordinateConversionResult(parent);
+    result->setType(option);
+    result->setNotation(QString("31U DQ %1 %2").arg(i % 100000, 5, 10, QChar('0'))
+                                                .arg((i * 7) % 100000, 5, 10, QChar('0')));
+    results.append(result);
+  }
+  return results;
+}
+
+std::unique_ptr<QAbstractListModel> tst_CoordinateConversion::createResultModel(
+  bool typed, const QList<CoordinateConversionResult*>& results)
+{
+  if (typed)
+  {
+    auto model = new TypedResultModel;
+    model->append(results);
+    return std::unique_ptr<QAbstractListModel>(model);
+  }
+
+  auto model = new GenericListModel(&CoordinateConversionResult::staticMetaObject);
+  QList<QObject*> objects;
+  objects.reserve(results.size());
+  for (auto result : results)
+    objects.append(result);
+
+  model->append(objects);
+  return std::unique_ptr<QAbstractListModel>(model);
+}
+
+TOOLKIT_TEST_MAIN(tst_CoordinateConversion)
+
+#include "tst_coordinateconversion.moc"
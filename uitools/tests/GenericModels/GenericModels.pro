@@ -0,0 +1,44 @@
+###############################################################################
+# Copyright 2012-2020 Esri
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+###############################################################################
+
+TEMPLATE = app
+
+TARGET = tst_genericmodels
+
+include($$PWD/../common/common.pri)
+
+QT += widgets qml quick
+
+HEADERS += \
+    $$CPPPATH/Internal/ElementTypeInfo.h \
+    $$CPPPATH/Internal/GadgetListModel.h \
+    $$CPPPATH/Internal/GenericListModel.h \
+    $$CPPPATH/Internal/GenericTableProxyModel.h \
+    $$CPPPATH/Internal/SignalDispatcher.h
+
+SOURCES += \
+    tst_genericmodels.cpp \
+    $$CPPPATH/Internal/ElementTypeInfo.cpp \
+    $$CPPPATH/Internal/GadgetListModel.cpp \
+    $$CPPPATH/Internal/GenericListModel.cpp \
+    $$CPPPATH/Internal/GenericTableProxyModel.cpp \
+    $$CPPPATH/Internal/SignalDispatcher.cpp
+
+RESOURCES += \
+    GenericModels.qrc
+
+OTHER_FILES += \
+    ListViewHost.qml
@@ -0,0 +1,28 @@
+/*******************************************************************************
+ *  Copyright 2012-2020 Esri
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+import QtQuick 2.12
+
+// Hosts the list model under test, exposed as the context property
+// "elementModel", in a ListView whose delegates bind to every role.
+ListView {
+    width: 800
+    height: 600
+    model: elementModel
+    delegate: Text {
+        text: model.name + " " + model.value + " " + model.latitude.toFixed(6)
+              + " " + model.longitude.toFixed(6) + " " + model.active
+    }
+}
@@ -0,0 +1,846 @@
+/*******************************************************************************
+ *  Copyright 2012-2020 Esri
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+#include "TestMain.h"
+
+// Toolkit headers
+#include "Internal/GadgetListModel.h"
+#include "Internal/GenericListModel.h"
+#include "Internal/GenericTableProxyModel.h"
+
+// Qt headers
+#include <QPointer>
+#include <QQmlContext>
+#include <QQuickView>
+#include <QQuickWindow>
+#include <QSGRendererInterface>
+#include <QTableView>
+#include <QtTest>
+
+// std headers
+#include <algorithm>
+#include <memory>
+
+using namespace Esri::ArcGISRuntime::Toolkit;
+
+namespace
+{
+
+// Rows held by the model while data is read or properties change.
+constexpr int ModelRows = 10000;
+
+}
+
+// A list element with five notifying properties, as a
+// CoordinateConversionResult-like object would have.
+class TestElement : public QObject
+{
+  Q_OBJECT
+  Q_PROPERTY(QString name READ name WRITE setName NOTIFY nameChanged)
+  Q_PROPERTY(int value READ value WRITE setValue NOTIFY valueChanged)
+  Q_PROPERTY(double latitude READ latitude WRITE setLatitude NOTIFY latitudeChanged)
+  Q_PROPERTY(double longitude READ longitude WRITE setLongitude NOTIFY longitudeChanged)
+  Q_PROPERTY(bool active READ active WRITE setActive NOTIFY activeChanged)
+public:
+  Q_INVOKABLE explicit TestElement(QObject* parent = nullptr) :
+    QObject(parent)
+  {
+  }
+
+  QString name() const { return m_name; }
+  void setName(const QString& name)
+  {
+    if (m_name == name)
+      return;
+
+    m_name = name;
+    emit nameChanged();
+  }
+
+  int value() const { return m_value; }
+  void setValue(int value)
+  {
+    if (m_value == value)
+      return;
+
+    m_value = value;
+    emit valueChanged();
+  }
+
+  double latitude() const { return m_latitude; }
+  void setLatitude(double latitude)
+  {
+    if (m_latitude == latitude)
+      return;
+
+    m_latitude = latitude;
+    emit latitudeChanged();
+  }
+
+  double longitude() const { return m_longitude; }
+  void setLongitude(double longitude)
+  {
+    if (m_longitude == longitude)
+      return;
+
+    m_longitude = longitude;
+    emit longitudeChanged();
+  }
+
+  bool active() const { return m_active; }
+  void setActive(bool active)
+  {
+    if (m_active == active)
+      return;
+
+    m_active = active;
+    emit activeChanged();
+  }
+
+signals:
+  void nameChanged();
+  void valueChanged();
+  void latitudeChanged();
+  void longitudeChanged();
+  void activeChanged();
+
+private:
+  QString m_name;
+  int m_value = 0;
+  double m_latitude = 0.0;
+  double m_longitude = 0.0;
+  bool m_active = false;
+};
+
+// The value-type counterpart of TestElement, with the same properties in the
+// same order, as stored by GadgetListModel.
+class TestGadget
+{
+  Q_GADGET
+  Q_PROPERTY(QString name MEMBER name)
+  Q_PROPERTY(int value MEMBER value)
+  Q_PROPERTY(double latitude MEMBER latitude)
+  Q_PROPERTY(double longitude MEMBER longitude)
+  Q_PROPERTY(bool active MEMBER active)
+public:
+  QString name;
+  int value = 0;
+  double latitude = 0.0;
+  double longitude = 0.0;
+  bool active = false;
+};
+
+Q_DECLARE_METATYPE(TestGadget)
+
+// The per-object connect path GenericListModel used before it routed notify
+// signals through a SignalDispatcher: one relay QObject, holding a persistent
+// index, per notifying property of every element.
+class PropertyRelay : public QObject
+{
+  Q_OBJECT
+public:
+  PropertyRelay(const QModelIndex& index, int role, QObject* element, QAbstractItemModel* model) :
+    QObject(model),
+    m_index(index),
+    m_role(role),
+    m_model(model)
+  {
+    connect(this, &PropertyRelay::propertyChanged, this, &PropertyRelay::emitDataChanged);
+    connect(element, &QObject::destroyed, this, &QObject::deleteLater);
+  }
+
+signals:
+  void propertyChanged();
+
+private:
+  void emitDataChanged()
+  {
+    if (m_index.isValid())
+      emit m_model->dataChanged(m_index, m_index, { Qt::UserRole, m_role });
+  }
+
+  QPersistentModelIndex m_index;
+  int m_role = -1;
+  QAbstractItemModel* m_model = nullptr;
+};
+
+// A list model which only connects its elements, through PropertyRelay.
+class RelayListModel : public QAbstractListModel
+{
+public:
+  explicit RelayListModel(QObject* parent = nullptr) :
+    QAbstractListModel(parent)
+  {
+  }
+
+  int rowCount(const QModelIndex& parent = QModelIndex()) const override
+  {
+    return parent.isValid() ? 0 : m_objects.size();
+  }
+
+  QVariant data(const QModelIndex& /*index*/, int /*role*/) const override
+  {
+    return QVariant();
+  }
+
+  void append(const QList<QObject*>& objects)
+  {
+    const int first = m_objects.size();
+    beginInsertRows(QModelIndex(), first, first + objects.size() - 1);
+    m_objects << objects;
+    endInsertRows();
+
+    static const QMetaMethod relaySignal = QMetaMethod::fromSignal(&PropertyRelay::propertyChanged);
+    for (int row = first; row < m_objects.size(); ++row)
+    {
+      QObject* object = m_objects.at(row);
+      const QMetaObject* metaObject = object->metaObject();
+      const int offset = metaObject->propertyOffset();
+      for (int i = offset; i < metaObject->propertyCount(); ++i)
+      {
+        const auto property = metaObject->property(i);
+        if (!property.hasNotifySignal())
+          continue;
+
+        auto relay = new PropertyRelay(index(row), i - offset + Qt::UserRole + 1, object, this);
+        connect(object, property.notifySignal(), relay, relaySignal);
+      }
+    }
+  }
+
+private:
+  QList<QObject*> m_objects;
+};
+
+class tst_GenericModels : public QObject
+{
+  Q_OBJECT
+
+private slots:
+  void initTestCase();
+
+  void append_data();
+  void append();
+
+  void appendMemory_data();
+  void appendMemory();
+
+  void gadgetAppend_data();
+  void gadgetAppend();
+
+  void rowMemory_data();
+  void rowMemory();
+
+  void data_data();
+  void data();
+
+  void gadgetData_data();
+  void gadgetData();
+
+  void roleNames();
+
+  void gadgetRoleNames();
+
+  void proxyData_data();
+  void proxyData();
+
+  void propertyStorm_data();
+  void propertyStorm();
+
+  void connectPath_data();
+  void connectPath();
+
+  void connectPathMemory_data();
+  void connectPathMemory();
+
+  void notifyPath_data();
+  void notifyPath();
+
+  void setObjects_data();
+  void setObjects();
+
+  void destroyChurn_data();
+  void destroyChurn();
+
+private:
+  static QList<QObject*> createElements(int count, QObject* parent);
+
+  static QVariantList createGadgets(int count);
+
+  static std::unique_ptr<QWidget> createTableView(QAbstractItemModel* model);
+
+  static std::unique_ptr<QQuickView> createListView(QAbstractItemModel* model);
+};
+
+void tst_GenericModels::initTestCase()
+{
+  // The offscreen platform has no OpenGL, so render QML in software.
+  QQuickWindow::setSceneGraphBackend(QSGRendererInterface::Software);
+}
+
+void tst_GenericModels::append_data()
+{
+  QTest::addColumn<int>("count");
+
+  QTest::newRow("1k") << 1000;
+  QTest::newRow("10k") << 10000;
+  QTest::newRow("100k") << 100000;
+}
+
+void tst_GenericModels::append()
+{
+  QFETCH(int, count);
+
+  QObject owner;
+  const auto elements = createElements(count, &owner);
+
+  // Each iteration connects every element to a fresh model, and tears the
+  // connections down again when the model is destroyed.
+  QBENCHMARK
+  {
+    GenericListModel model(&TestElement::staticMetaObject);
+    QVERIFY(model.append(elements));
+    QCOMPARE(model.rowCount(), count);
+  }
+}
+
+void tst_GenericModels::appendMemory_data()
+{
+  append_data();
+}
+
+void tst_GenericModels::appendMemory()
+{
+  QFETCH(int, count);
+
+  if (Tests::heapUsage() < 0)
+    QSKIP("Heap usage is not available on this platform.");
+
+  QObject owner;
+  const auto elements = createElements(count, &owner);
+
+  const qint64 before = Tests::heapUsage();
+  GenericListModel model(&TestElement::staticMetaObject);
+  QVERIFY(model.append(elements));
+  const qint64 after = Tests::heapUsage();
+
+  QTest::setBenchmarkResult(after - before, QTest::BytesAllocated);
+}
+
+void tst_GenericModels::gadgetAppend_data()
+{
+  append_data();
+}
+
+void tst_GenericModels::gadgetAppend()
+{
+  QFETCH(int, count);
+
+  const auto gadgets = createGadgets(count);
+
+  // Each iteration unpacks every gadget into the columns of a fresh model.
+  QBENCHMARK
+  {
+    GadgetListModel model(&TestGadget::staticMetaObject, qMetaTypeId<TestGadget>());
+    QVERIFY(model.append(gadgets));
+    QCOMPARE(model.rowCount(), count);
+  }
+}
+
+void tst_GenericModels::rowMemory_data()
+{
+  QTest::addColumn<int>("count");
+  QTest::addColumn<bool>("gadget");
+
+  for (int count : { 1000, 10000, 100000 })
+  {
+    const auto rows = QString("%1k").arg(count / 1000);
+    QTest::newRow(qPrintable(rows + " GenericListModel")) << count << false;
+    QTest::newRow(qPrintable(rows + " GadgetListModel")) << count << true;
+  }
+}
+
+void tst_GenericModels::rowMemory()
+{
+  QFETCH(int, count);
+  QFETCH(bool, gadget);
+
+  if (Tests::heapUsage() < 0)
+    QSKIP("Heap usage is not available on this platform.");
+
+  // Unlike appendMemory, the elements are counted too: a GenericListModel
+  // keeps its QObjects alive, while a GadgetListModel keeps only its columns
+  // once the gadgets it was given are released.
+  const qint64 before = Tests::heapUsage();
+  QObject owner;
+  std::unique_ptr<QAbstractItemModel> model;
+  if (gadget)
+  {
+    auto gadgetModel = new GadgetListModel(&TestGadget::staticMetaObject, qMetaTypeId<TestGadget>());
+    model.reset(gadgetModel);
+    QVERIFY(gadgetModel->append(createGadgets(count)));
+  }
+  else
+  {
+    auto genericModel = new GenericListModel(&TestElement::staticMetaObject);
+    model.reset(genericModel);
+    QVERIFY(genericModel->append(createElements(count, &owner)));
+  }
+  const qint64 after = Tests::heapUsage();
+
+  QCOMPARE(model->rowCount(), count);
+  QTest::setBenchmarkResult(after - before, QTest::BytesAllocated);
+}
+
+void tst_GenericModels::data_data()
+{
+  QTest::addColumn<int>("role");
+
+  GenericListModel model(&TestElement::staticMetaObject);
+  const auto roles = model.roleNames();
+  for (auto it = roles.cbegin(); it != roles.cend(); ++it)
+    QTest::newRow(it.value().constData()) << it.key();
+
+  QTest::newRow("display") << static_cast<int>(Qt::DisplayRole);
+}
+
+void tst_GenericModels::data()
+{
+  QFETCH(int, role);
+
+  GenericListModel model(&TestElement::staticMetaObject);
+  model.setDisplayPropertyName("name");
+  QVERIFY(model.append(createElements(ModelRows, &model)));
+
+  QBENCHMARK
+  {
+    for (int row = 0; row < ModelRows; ++row)
+      model.data(model.index(row), role);
+  }
+}
+
+void tst_GenericModels::gadgetData_data()
+{
+  QTest::addColumn<int>("role");
+
+  GadgetListModel model(&TestGadget::staticMetaObject, qMetaTypeId<TestGadget>());
+  const auto roles = model.roleNames();
+  for (auto it = roles.cbegin(); it != roles.cend(); ++it)
+    QTest::newRow(it.value().constData()) << it.key();
+
+  QTest::newRow("display") << static_cast<int>(Qt::DisplayRole);
+}
+
+void tst_GenericModels::gadgetData()
+{
+  QFETCH(int, role);
+
+  GadgetListModel model(&TestGadget::staticMetaObject, qMetaTypeId<TestGadget>());
+  model.setDisplayPropertyName("name");
+  QVERIFY(model.append(createGadgets(ModelRows)));
+
+  QBENCHMARK
+  {
+    for (int row = 0; row < ModelRows; ++row)
+      model.data(model.index(row), role);
+  }
+}
+
+void tst_GenericModels::roleNames()
+{
+  GenericListModel model(&TestElement::staticMetaObject);
+
+  QBENCHMARK
+  {
+    QCOMPARE(model.roleNames().size(), 6);
+  }
+}
+
+void tst_GenericModels::gadgetRoleNames()
+{
+  // The same property layout gives the same roles, so a view can switch
+  // between the two models without changing its delegates.
+  GenericListModel genericModel(&TestElement::staticMetaObject);
+  GadgetListModel gadgetModel(&TestGadget::staticMetaObject, qMetaTypeId<TestGadget>());
+  QCOMPARE(gadgetModel.roleNames(), genericModel.roleNames());
+
+  // The values behind each role match too.
+  QObject owner;
+  QVERIFY(genericModel.append(createElements(3, &owner)));
+  QVERIFY(gadgetModel.append(createGadgets(3)));
+  const auto roles = genericModel.roleNames();
+  for (int row = 0; row < 3; ++row)
+  {
+    for (auto it = roles.cbegin(); it != roles.cend(); ++it)
+    {
+      if (it.key() == Qt::UserRole)
+        continue;
+
+      QCOMPARE(gadgetModel.data(gadgetModel.index(row), it.key()),
+               genericModel.data(genericModel.index(row), it.key()));
+    }
+  }
+}
+
+void tst_GenericModels::proxyData_data()
+{
+  QTest::addColumn<int>("column");
+
+  const auto& metaObject = TestElement::staticMetaObject;
+  for (int i = metaObject.propertyOffset(); i < metaObject.propertyCount(); ++i)
+    QTest::newRow(metaObject.property(i).name()) << i - metaObject.propertyOffset();
+}
+
+void tst_GenericModels::proxyData()
+{
+  QFETCH(int, column);
+
+  GenericListModel model(&TestElement::staticMetaObject);
+  QVERIFY(model.append(createElements(ModelRows, &model)));
+
+  GenericTableProxyModel proxy;
+  proxy.setSourceModel(&model);
+  QCOMPARE(proxy.rowCount(), ModelRows);
+
+  QBENCHMARK
+  {
+    for (int row = 0; row < ModelRows; ++row)
+      proxy.data(proxy.index(row, column), Qt::DisplayRole);
+  }
+}
+
+void tst_GenericModels::propertyStorm_data()
+{
+  QTest::addColumn<QString>("view");
+  QTest::addColumn<bool>("batching");
+
+  for (const QString view : { "none", "table", "quick" })
+  {
+    QTest::newRow(qPrintable(view)) << view << false;
+    QTest::newRow(qPrintable(view + " batched")) << view << true;
+  }
+}
+
+void tst_GenericModels::propertyStorm()
+{
+  QFETCH(QString, view);
+  QFETCH(bool, batching);
+
+  // Declared ahead of the model, so the model and its views go first.
+  QObject owner;
+  const auto elements = createElements(ModelRows, &owner);
+
+  GenericListModel model(&TestElement::staticMetaObject);
+  model.setDisplayPropertyName("name");
+  model.setBatchingEnabled(batching);
+  QVERIFY(model.append(elements));
+
+  GenericTableProxyModel proxy;
+  proxy.setSourceModel(&model);
+
+  std::unique_ptr<QWidget> tableView;
+  std::unique_ptr<QQuickView> quickView;
+  if (view == "table")
+  {
+    tableView = createTableView(&proxy);
+    QVERIFY(QTest::qWaitForWindowExposed(tableView.get()));
+  }
+  else if (view == "quick")
+  {
+    quickView = createListView(&model);
+    QVERIFY(quickView->rootObject());
+    QVERIFY(QTest::qWaitForWindowExposed(quickView.get()));
+  }
+
+  // Every element changes one property, then the views catch up.
+  int generation = 0;
+  QBENCHMARK
+  {
+    ++generation;
+    for (auto element : elements)
+      static_cast<TestElement*>(element)->setValue(generation);
+
+    model.flush();
+    QCoreApplication::processEvents();
+  }
+}
+
+void tst_GenericModels::connectPath_data()
+{
+  QTest::addColumn<bool>("dispatcher");
+  QTest::addColumn<int>("count");
+
+  QTest::newRow("dispatcher 1k") << true << 1000;
+  QTest::newRow("dispatcher 10k") << true << 10000;
+  QTest::newRow("relay 1k") << false << 1000;
+  QTest::newRow("relay 10k") << false << 10000;
+}
+
+void tst_GenericModels::connectPath()
+{
+  QFETCH(bool, dispatcher);
+  QFETCH(int, count);
+
+  QObject owner;
+  const auto elements = createElements(count, &owner);
+
+  QBENCHMARK
+  {
+    if (dispatcher)
+    {
+      GenericListModel model(&TestElement::staticMetaObject);
+      model.append(elements);
+    }
+    else
+    {
+      RelayListModel model;
+      model.append(elements);
+    }
+  }
+}
+
+void tst_GenericModels::connectPathMemory_data()
+{
+  connectPath_data();
+}
+
+void tst_GenericModels::connectPathMemory()
+{
+  QFETCH(bool, dispatcher);
+  QFETCH(int, count);
+
+  if (Tests::heapUsage() < 0)
+    QSKIP("Heap usage is not available on this platform.");
+
+  QObject owner;
+  const auto elements = createElements(count, &owner);
+
+  const qint64 before = Tests::heapUsage();
+  std::unique_ptr<QAbstractListModel> model;
+  if (dispatcher)
+  {
+    auto genericModel = new GenericListModel(&TestElement::staticMetaObject);
+    genericModel->append(elements);
+    model.reset(genericModel);
+  }
+  else
+  {
+    auto relayModel = new RelayListModel;
+    relayModel->append(elements);
+    model.reset(relayModel);
+  }
+  const qint64 after = Tests::heapUsage();
+
+  QCOMPARE(model->rowCount(), count);
+  QTest::setBenchmarkResult(after - before, QTest::BytesAllocated);
+}
+
+void tst_GenericModels::notifyPath_data()
+{
+  QTest::addColumn<bool>("dispatcher");
+  QTest::addColumn<int>("count");
+
+  QTest::newRow("dispatcher") << true << ModelRows;
+  QTest::newRow("relay") << false << ModelRows;
+}
+
+void tst_GenericModels::notifyPath()
+{
+  QFETCH(bool, dispatcher);
+  QFETCH(int, count);
+
+  QObject owner;
+  const auto elements = createElements(count, &owner);
+
+  std::unique_ptr<QAbstractListModel> model;
+  if (dispatcher)
+  {
+    auto genericModel = new GenericListModel(&TestElement::staticMetaObject);
+    genericModel->append(elements);
+    model.reset(genericModel);
+  }
+  else
+  {
+    auto relayModel = new RelayListModel;
+    relayModel->append(elements);
+    model.reset(relayModel);
+  }
+
+  int changes = 0;
+  connect(model.get(), &QAbstractItemModel::dataChanged, this, [&changes]() { ++changes; });
+
+  int generation = 0;
+  QBENCHMARK
+  {
+    ++generation;
+    for (auto element : elements)
+      static_cast<TestElement*>(element)->setValue(generation);
+  }
+  QCOMPARE(changes, count * generation);
+}
+
+void tst_GenericModels::setObjects_data()
+{
+  QTest::addColumn<QVector<int>>("before");
+  QTest::addColumn<QVector<int>>("after");
+  QTest::addColumn<int>("moves");
+
+  QTest::newRow("rotate left") << QVector<int>{0, 1, 2, 3, 4, 5} << QVector<int>{1, 2, 3, 4, 5, 0} << 1;
+  QTest::newRow("rotate right") << QVector<int>{0, 1, 2, 3, 4, 5} << QVector<int>{5, 0, 1, 2, 3, 4} << 1;
+  QTest::newRow("swap halves") << QVector<int>{0, 1, 2, 3, 4, 5} << QVector<int>{3, 4, 5, 0, 1, 2} << 1;
+  QTest::newRow("swap ends") << QVector<int>{0, 1, 2, 3} << QVector<int>{3, 1, 2, 0} << 2;
+  QTest::newRow("reverse") << QVector<int>{0, 1, 2, 3, 4} << QVector<int>{4, 3, 2, 1, 0} << 4;
+  QTest::newRow("mixed") << QVector<int>{0, 1, 2, 3, 4} << QVector<int>{5, 3, 0, 6, 2} << 1;
+  QTest::newRow("keep") << QVector<int>{0, 1, 2, 3} << QVector<int>{0, 4, 2, 5} << 0;
+}
+
+void tst_GenericModels::setObjects()
+{
+  QFETCH(QVector<int>, before);
+  QFETCH(QVector<int>, after);
+  QFETCH(int, moves);
+
+  GenericListModel model(&TestElement::staticMetaObject);
+  const auto elements = createElements(8, &model);
+  QList<QPointer<QObject>> tracked;
+  for (auto element : elements)
+    tracked.append(element);
+
+  auto pick = [&elements](const QVector<int>& rows)
+  {
+    QList<QObject*> picked;
+    for (int row : rows)
+      picked.append(elements.at(row));
+    return picked;
+  };
+  QVERIFY(model.setObjects(pick(before)));
+
+  QSignalSpy moved(&model, &QAbstractItemModel::rowsMoved);
+  QSignalSpy changed(&model, &QAbstractItemModel::dataChanged);
+  QVERIFY(model.setObjects(pick(after)));
+  QCOMPARE(moved.count(), moves);
+
+  QCOMPARE(model.rowCount(), after.size());
+  for (int row = 0; row < after.size(); ++row)
+    QCOMPARE(model.element<QObject>(model.index(row)), elements.at(after.at(row)));
+
+  // Only elements dropped from the list are deleted.
+  for (int i = 0; i < elements.size(); ++i)
+    QCOMPARE(tracked.at(i).isNull(), before.contains(i) && !after.contains(i));
+
+  // Kept, moved and inserted rows all still forward their notify signals.
+  for (int row = 0; row < after.size(); ++row)
+  {
+    changed.clear();
+    static_cast<TestElement*>(elements.at(after.at(row)))->setValue(-1);
+    QCOMPARE(changed.count(), 1);
+    QCOMPARE(changed.first().first().toModelIndex().row(), row);
+  }
+
+  // And their rows are removed when they are deleted elsewhere.
+  for (int remaining = after.size(); remaining > 0; --remaining)
+  {
+    delete model.element<QObject>(model.index(0));
+    QTRY_COMPARE(model.rowCount(), remaining - 1);
+  }
+}
+
+void tst_GenericModels::destroyChurn_data()
+{
+  QTest::addColumn<bool>("forward");
+
+  QTest::newRow("forward") << true;
+  QTest::newRow("backward") << false;
+}
+
+void tst_GenericModels::destroyChurn()
+{
+  QFETCH(bool, forward);
+
+  // Deletes every other element elsewhere, front to back or back to front,
+  // then lets the model catch up. Each deletion looks up its row, so this
+  // measures how often the row index is renumbered.
+  QBENCHMARK
+  {
+    QObject owner;
+    GenericListModel model(&TestElement::staticMetaObject);
+    QVERIFY(model.append(createElements(ModelRows, &owner)));
+
+    QList<QObject*> doomed;
+    for (int row = 0; row < ModelRows; row += 2)
+      doomed.append(model.element<QObject>(model.index(row)));
+    if (!forward)
+      std::reverse(doomed.begin(), doomed.end());
+
+    qDeleteAll(doomed);
+    QTRY_COMPARE(model.rowCount(), ModelRows / 2);
+  }
+}
+
+QList<QObject*> tst_GenericModels::createElements(int count, QObject* parent)
+{
+  QList<QObject*> elements;
+  elements.reserve(count);
+  for (int i = 0; i < count; ++i)
+  {
+    auto element = new TestElement(parent);
+    element->setName(QString::number(i));
+    element->setValue(i);
+    element->setLatitude(-90.0 + 180.0 * i / count);
+    element->setLongitude(-180.0 + 360.0 * i / count);
+    element->setActive(i % 2 == 0);
+    elements.append(element);
+  }
+  return elements;
+}
+
+QVariantList tst_GenericModels::createGadgets(int count)
+{
+  QVariantList gadgets;
+  gadgets.reserve(count);
+  for (int i = 0; i < count; ++i)
+  {
+    TestGadget gadget;
+    gadget.name = QString::number(i);
+    gadget.value = i;
+    gadget.latitude = -90.0 + 180.0 * i / count;
+    gadget.longitude = -180.0 + 360.0 * i / count;
+    gadget.active = i % 2 == 0;
+    gadgets.append(QVariant::fromValue(gadget));
+  }
+  return gadgets;
+}
+
+std::unique_ptr<QWidget> tst_GenericModels::createTableView(QAbstractItemModel* model)
+{
+  auto view = new QTableView;
+  view->setModel(model);
+  view->resize(800, 600);
+  view->show();
+  return std::unique_ptr<QWidget>(view);
+}
+
+std::unique_ptr<QQuickView> tst_GenericModels::createListView(QAbstractItemModel* model)
+{
+  std::unique_ptr<QQuickView> view(new QQuickView);
+  view->rootContext()->setContextProperty("elementModel", model);
+  view->setSource(QUrl("qrc:/ListViewHost.qml"));
+  view->show();
+  return view;
+}
+
+TOOLKIT_TEST_MAIN(tst_GenericModels)
+
+#include "tst_genericmodels.moc"
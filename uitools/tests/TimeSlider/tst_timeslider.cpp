@@ -0,0 +1,217 @@
+/*******************************************************************************
+ *  Copyright 2012-2020 Esri
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+#include "TestMain.h"
+
+// Toolkit headers
+#include "Internal/TimeStepTable.h"
+
+// Qt headers
+#include <QDateTime>
+#include <QTimeZone>
+#include <QtTest>
+
+// ArcGISRuntime headers
+#include <TimeExtent.h>
+#include <TimeValue.h>
+
+using namespace Esri::ArcGISRuntime;
+using namespace Esri::ArcGISRuntime::Toolkit;
+
+namespace
+{
+
+// The page size and page count of the TimeStepTable cache, which bound the
+// memory of the boundaries it holds to 512 KiB.
+constexpr int PageSize = 4096;
+constexpr int MaxCachedPages = 16;
+
+// Seconds in the extent of the largest table, which is far more steps of one
+// second than the cache can hold.
+constexpr int LargeExtentSeconds = 30 * 24 * 3600;
+
+QDateTime utc(int year, int month, int day, int hour = 0)
+{
+  return QDateTime(QDate(year, month, day), QTime(hour, 0), Qt::UTC);
+}
+
+}
+
+class tst_TimeSlider : public QObject
+{
+  Q_OBJECT
+
+private slots:
+  void monthsFromMonthEnd();
+  void daysAcrossDaylightSaving();
+
+  void roundTrip_data();
+  void roundTrip();
+
+  void largeExtentMemory();
+};
+
+void tst_TimeSlider::monthsFromMonthEnd()
+{
+  const auto start = utc(2021, 1, 31);
+  TimeStepTable table;
+  table.reset(TimeExtent(start, utc(2022, 1, 31)), TimeValue(1.0, TimeUnit::Months));
+  QCOMPARE(table.numberOfSteps(), 12);
+
+  // Each boundary is counted from the start, so the 31st is kept in every
+  // month long enough, rather than creeping to the 28th after February.
+  for (int step = 0; step <= table.numberOfSteps(); ++step)
+    QCOMPARE(table.timeForStep(step), start.addMonths(step));
+
+  QCOMPARE(table.timeForStep(1), utc(2021, 2, 28));
+  QCOMPARE(table.timeForStep(2), utc(2021, 3, 31));
+  QCOMPARE(table.timeForStep(3), utc(2021, 4, 30));
+  QCOMPARE(table.timeForStep(12), utc(2022, 1, 31));
+
+  // Leap years are counted too.
+  table.reset(TimeExtent(utc(2020, 1, 31), utc(2028, 2, 1)), TimeValue(1.0, TimeUnit::Years));
+  QCOMPARE(table.numberOfSteps(), 9);
+  QCOMPARE(table.timeForStep(8), utc(2028, 1, 31));
+}
+
+void tst_TimeSlider::daysAcrossDaylightSaving()
+{
+  const QTimeZone berlin("Europe/Berlin");
+  if (!berlin.isValid())
+    QSKIP("The Europe/Berlin time zone is not available.");
+
+  // Clocks in Berlin went forward an hour at 02:00 on 28 March 2021.
+  const QDateTime start(QDate(2021, 3, 26), QTime(12, 0), berlin);
+  const QDateTime end(QDate(2021, 3, 31), QTime(12, 0), berlin);
+  const TimeExtent extent(start, end);
+  TimeStepTable table;
+  table.reset(extent, TimeValue(1.0, TimeUnit::Days));
+  QCOMPARE(table.numberOfSteps(), 5);
+
+  // Steps are calendar days in the time spec of the start of the extent.
+  const auto extentStart = extent.startTime();
+  for (int step = 0; step <= table.numberOfSteps(); ++step)
+    QCOMPARE(table.timeForStep(step), extentStart.addDays(step));
+
+  if (extentStart.timeSpec() != Qt::TimeZone)
+    QSKIP("TimeExtent does not keep the time zone of its times.");
+
+  // So they land on noon in Berlin, and the step over the change is an hour
+  // shorter than the others.
+  for (int step = 0; step <= table.numberOfSteps(); ++step)
+  {
+    const auto time = table.timeForStep(step).toTimeZone(berlin);
+    QCOMPARE(time.date(), start.date().addDays(step));
+    QCOMPARE(time.time(), QTime(12, 0));
+  }
+
+  constexpr qint64 day = 24 * 3600 * 1000;
+  QCOMPARE(table.msecsForStep(1) - table.msecsForStep(0), day);
+  QCOMPARE(table.msecsForStep(2) - table.msecsForStep(1), day - 3600 * 1000);
+  QCOMPARE(table.msecsForStep(3) - table.msecsForStep(2), day);
+}
+
+void tst_TimeSlider::roundTrip_data()
+{
+  QTest::addColumn<double>("duration");
+  QTest::addColumn<int>("unit");
+  QTest::addColumn<QDateTime>("end");
+
+  // Most extents span more than one page of boundaries.
+  const auto start = utc(2021, 1, 31);
+  QTest::newRow("months") << 1.0 << static_cast<int>(TimeUnit::Months) << start.addYears(400);
+  QTest::newRow("quarters") << 3.0 << static_cast<int>(TimeUnit::Months) << start.addYears(20);
+  QTest::newRow("decades") << 1.0 << static_cast<int>(TimeUnit::Decades) << start.addYears(500);
+  QTest::newRow("weeks") << 1.0 << static_cast<int>(TimeUnit::Weeks) << start.addYears(100);
+  QTest::newRow("days") << 1.0 << static_cast<int>(TimeUnit::Days) << start.addYears(30);
+  QTest::newRow("fractional days") << 1.5 << static_cast<int>(TimeUnit::Days) << start.addYears(30);
+  QTest::newRow("minutes") << 90.0 << static_cast<int>(TimeUnit::Minutes) << start.addDays(400);
+  QTest::newRow("partial last step") << 7.0 << static_cast<int>(TimeUnit::Hours) << start.addDays(1000).addSecs(1);
+}
+
+void tst_TimeSlider::roundTrip()
+{
+  QFETCH(double, duration);
+  QFETCH(int, unit);
+  QFETCH(QDateTime, end);
+
+  const auto start = utc(2021, 1, 31);
+  TimeStepTable table;
+  table.reset(TimeExtent(start, end), TimeValue(duration, static_cast<TimeUnit>(unit)));
+  const int steps = table.numberOfSteps();
+  QVERIFY(steps > 0);
+
+  // The last boundary is the first one at or after the end.
+  QVERIFY(table.msecsForStep(steps) >= end.toMSecsSinceEpoch());
+  QVERIFY(table.msecsForStep(steps - 1) < end.toMSecsSinceEpoch());
+
+  for (int step = 0; step <= steps; ++step)
+  {
+    const auto time = table.timeForStep(step);
+    if (table.stepForTime(time) != step)
+      QFAIL(qPrintable(QString("Step %1 at %2 maps back to step %3")
+                       .arg(step).arg(time.toString(Qt::ISODateWithMs)).arg(table.stepForTime(time))));
+
+    // Times between two boundaries map to the later one.
+    if (step < steps)
+    {
+      const qint64 from = table.msecsForStep(step);
+      const qint64 to = table.msecsForStep(step + 1);
+      QVERIFY(to > from);
+      for (qint64 msecs : { from + 1, from + (to - from) / 2, to - 1 })
+        QCOMPARE(table.stepForTime(QDateTime::fromMSecsSinceEpoch(msecs, Qt::UTC)), step + 1);
+    }
+  }
+
+  // Times outside the extent are clamped to its steps.
+  QCOMPARE(table.stepForTime(start.addDays(-1)), 0);
+  QCOMPARE(table.stepForTime(table.timeForStep(steps).addDays(1)), steps);
+  QCOMPARE(table.stepForTime(QDateTime()), 0);
+}
+
+void tst_TimeSlider::largeExtentMemory()
+{
+  if (Tests::heapUsage() < 0)
+    QSKIP("Heap usage is not available on this platform.");
+
+  const auto start = utc(2021, 1, 1);
+  TimeStepTable table;
+  table.reset(TimeExtent(start, start.addSecs(LargeExtentSeconds)), TimeValue(1.0, TimeUnit::Seconds));
+  QCOMPARE(table.numberOfSteps(), LargeExtentSeconds);
+  QVERIFY(table.numberOfSteps() > 10 * PageSize * MaxCachedPages);
+
+  // Visit every boundary, then look up times spread over the whole extent,
+  // which touches every page several times over.
+  const qint64 before = Tests::heapUsage();
+  const qint64 startMsecs = start.toMSecsSinceEpoch();
+  for (int step = 0; step <= table.numberOfSteps(); ++step)
+  {
+    if (table.msecsForStep(step) != startMsecs + step * qint64(1000))
+      QFAIL(qPrintable(QString("Step %1 is at the wrong time").arg(step)));
+  }
+  for (int step = table.numberOfSteps(); step > 0; step -= 997)
+    QCOMPARE(table.stepForTime(start.addMSecs(step * qint64(1000) - 500)), step);
+  const qint64 after = Tests::heapUsage();
+
+  // Only the most recently used pages are kept, however many were visited.
+  const qint64 bound = 2 * qint64(sizeof(qint64)) * PageSize * MaxCachedPages;
+  QVERIFY2(after - before <= bound,
+           qPrintable(QString("The table grew by %1 bytes").arg(after - before)));
+  QTest::setBenchmarkResult(after - before, QTest::BytesAllocated);
+}
+
+TOOLKIT_TEST_MAIN(tst_TimeSlider)
+
+#include "tst_timeslider.moc"
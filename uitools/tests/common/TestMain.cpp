@@ -0,0 +1,120 @@
+/*******************************************************************************
+ *  Copyright 2012-2020 Esri
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+#include "TestMain.h"
+
+// Qt headers
+#include <QByteArray>
+
+// std headers
+#include <cstdio>
+
+#if defined(Q_OS_WIN)
+#include <windows.h>
+#include <psapi.h>
+#elif defined(Q_OS_UNIX)
+#include <sys/resource.h>
+#endif
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+namespace Esri
+{
+namespace ArcGISRuntime
+{
+namespace Toolkit
+{
+namespace Tests
+{
+
+/*!
+  \internal
+  \brief Selects the offscreen platform plugin, so the tests need no display,
+  unless another platform was asked for with \c QT_QPA_PLATFORM.
+
+  Must be called before the application object is created.
+ */
+void useOffscreenPlatform()
+{
+  if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM"))
+    qputenv("QT_QPA_PLATFORM", QByteArrayLiteral("offscreen"));
+}
+
+/*!
+  \internal
+  \brief Returns the number of bytes currently allocated on the heap, or -1
+  if the C library cannot report it.
+
+  Benchmarks report the difference before and after an operation with
+  \c{QTest::setBenchmarkResult(bytes, QTest::BytesAllocated)}.
+ */
+qint64 heapUsage()
+{
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+  const auto info = mallinfo2();
+  return static_cast<qint64>(info.uordblks + info.hblkhd);
+#else
+  return -1;
+#endif
+}
+
+/*!
+  \internal
+  \brief Returns the peak resident memory of this process in bytes, or -1 if
+  the platform cannot report it.
+ */
+qint64 peakMemoryUsage()
+{
+#if defined(Q_OS_WIN)
+  PROCESS_MEMORY_COUNTERS counters;
+  if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+    return -1;
+
+  return static_cast<qint64>(counters.PeakWorkingSetSize);
+#elif defined(Q_OS_UNIX)
+  rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0)
+    return -1;
+
+#if defined(Q_OS_DARWIN)
+  return static_cast<qint64>(usage.ru_maxrss);
+#else
+  return static_cast<qint64>(usage.ru_maxrss) * 1024; // Reported in kilobytes.
+#endif
+#else
+  return -1;
+#endif
+}
+
+/*!
+  \internal
+  \brief Prints the peak memory of this process to the standard output, after
+  the QTest results.
+ */
+void reportPeakMemoryUsage()
+{
+  const qint64 peak = peakMemoryUsage();
+  if (peak < 0)
+    std::printf("PEAK MEMORY: unavailable\n");
+  else
+    std::printf("PEAK MEMORY: %.1f MiB\n", peak / (1024.0 * 1024.0));
+}
+
+} // Tests
+} // Toolkit
+} // ArcGISRuntime
+} // Esri
@@ -0,0 +1,69 @@
+/*******************************************************************************
+ *  Copyright 2012-2020 Esri
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+#ifndef ESRI_ARCGISRUNTIME_TOOLKIT_TESTS_TESTMAIN_H
+#define ESRI_ARCGISRUNTIME_TOOLKIT_TESTS_TESTMAIN_H
+
+// Qt headers
+#include <QtGlobal>
+#include <QtTest>
+
+#if defined(QT_WIDGETS_LIB)
+#include <QApplication>
+#define TOOLKIT_TEST_APPLICATION QApplication
+#else
+#include <QGuiApplication>
+#define TOOLKIT_TEST_APPLICATION QGuiApplication
+#endif
+
+namespace Esri
+{
+namespace ArcGISRuntime
+{
+namespace Toolkit
+{
+namespace Tests
+{
+
+void useOffscreenPlatform();
+
+qint64 heapUsage();
+
+qint64 peakMemoryUsage();
+
+void reportPeakMemoryUsage();
+
+} // Tests
+} // Toolkit
+} // ArcGISRuntime
+} // Esri
+
+// Equivalent to QTEST_MAIN, except that the offscreen platform is used unless
+// QT_QPA_PLATFORM is set, and the peak memory of the process is printed once
+// all test functions have run.
+#define TOOLKIT_TEST_MAIN(TestObject) \
+int main(int argc, char* argv[]) \
+{ \
+  Esri::ArcGISRuntime::Toolkit::Tests::useOffscreenPlatform(); \
+  TOOLKIT_TEST_APPLICATION app(argc, argv); \
+  app.setAttribute(Qt::AA_Use96Dpi, true); \
+  TestObject tc; \
+  QTEST_SET_MAIN_SOURCE_PATH \
+  const int result = QTest::qExec(&tc, argc, argv); \
+  Esri::ArcGISRuntime::Toolkit::Tests::reportPeakMemoryUsage(); \
+  return result; \
+}
+
+#endif // ESRI_ARCGISRUNTIME_TOOLKIT_TESTS_TESTMAIN_H
@@ -0,0 +1,37 @@
+###############################################################################
+# Copyright 2012-2020 Esri
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+###############################################################################
+
+# Settings shared by every test target. Include this from the target's .pro
+# after setting TARGET.
+
+QT += core gui testlib
+CONFIG += c++14 console testcase
+CONFIG -= app_bundle
+
+TOOLKITPATH = $$PWD/../../cpp
+CPPPATH = $$TOOLKITPATH/Esri/ArcGISRuntime/Toolkit
+
+INCLUDEPATH += $$TOOLKITPATH $$CPPPATH $$PWD
+
+HEADERS += \
+    $$PWD/TestMain.h
+
+SOURCES += \
+    $$PWD/TestMain.cpp
+
+win32 {
+  LIBS += -lpsapi
+}
@@ -0,0 +1,31 @@
+###############################################################################
+# Copyright 2012-2020 Esri
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+###############################################################################
+
+# Headless QTest benchmarks for the toolkit. Build and run with
+#
+#   qmake tests.pro && make && make check
+#
+# Every test runs with the offscreen QPA unless QT_QPA_PLATFORM is set, and
+# reports the peak memory of the process once it finishes. CoordinateConversion
+# and TimeSlider link the ArcGIS Runtime SDK, located in the same way as the
+# toolkit's tools.
+
+TEMPLATE = subdirs
+
+SUBDIRS += \
+    CoordinateConversion \
+    GenericModels \
+    TimeSlider
@@ -0,0 +1,54 @@
+###############################################################################
+# Copyright 2012-2020 Esri
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+###############################################################################
+
+TEMPLATE = app
+
+QT += core concurrent
+QT -= gui
+CONFIG += c++14 console
+CONFIG -= app_bundle
+
+TARGET = BulkCoordinateConversion
+
+ARCGIS_RUNTIME_VERSION = 100.11
+include($$PWD/arcgisruntime.pri)
+
+# Only the coordinate conversion sources of the toolkit are needed, not the
+# UI controllers pulled in by common.pri.
+CPPPATH = $$PWD/../../cpp/Esri/ArcGISRuntime/Toolkit
+
+INCLUDEPATH += $$PWD/../../cpp $$CPPPATH
+
+HEADERS += \
+    BulkCoordinateConverter.h \
+    $$CPPPATH/CoordinateConversionConstants.h \
+    $$CPPPATH/CoordinateConversionOption.h \
+    $$CPPPATH/CoordinateFormatSpec.h \
+    $$CPPPATH/CoordinateOptionDefaults.h \
+    $$CPPPATH/Internal/GridReferenceFormatter.h \
+    $$CPPPATH/Internal/LatitudeLongitudeFormatter.h \
+    $$CPPPATH/Internal/NotationCache.h
+
+SOURCES += \
+    main.cpp \
+    BulkCoordinateConverter.cpp \
+    $$CPPPATH/CoordinateConversionConstants.cpp \
+    $$CPPPATH/CoordinateConversionOption.cpp \
+    $$CPPPATH/CoordinateFormatSpec.cpp \
+    $$CPPPATH/CoordinateOptionDefaults.cpp \
+    $$CPPPATH/Internal/GridReferenceFormatter.cpp \
+    $$CPPPATH/Internal/LatitudeLongitudeFormatter.cpp \
+    $$CPPPATH/Internal/NotationCache.cpp
@@ -0,0 +1,485 @@
+/*******************************************************************************
+ *  Copyright 2012-2020 Esri
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+#include "BulkCoordinateConverter.h"
+
+// Toolkit headers
+#include "CoordinateConversionConstants.h"
+#include "CoordinateConversionOption.h"
+#include "CoordinateOptionDefaults.h"
+
+// Qt headers
+#include <QElapsedTimer>
+#include <QFile>
+#include <QFuture>
+#include <QQueue>
+#include <QThread>
+#include <QtConcurrent>
+
+// std headers
+#include <algorithm>
+#include <cstring>
+#include <memory>
+
+namespace Esri
+{
+namespace ArcGISRuntime
+{
+namespace Toolkit
+{
+
+namespace
+{
+
+constexpr qint64 PROGRESS_INTERVAL = 1000;
+
+// Returns the end of the line starting at \a begin, excluding the line break,
+// and sets \a next to the start of the following line.
+const char* lineEnd(const char* begin, const char* end, const char** next)
+{
+  auto newline = static_cast<const char*>(std::memchr(begin, '\n', end - begin));
+  *next = newline ? newline + 1 : end;
+
+  const char* last = newline ? newline : end;
+  if (last > begin && *(last - 1) == '\r')
+    --last;
+
+  return last;
+}
+
+}
+
+/*!
+  \class Esri::ArcGISRuntime::Toolkit::BulkCoordinateConverter
+  \brief Converts a column of coordinate notations in a delimited text file
+  to one or more other notations.
+
+  The input file is memory-mapped and cut into chunks that end on line
+  breaks. Chunks are converted on the global thread pool and written to the
+  output in input order. At most \l setMaxPendingChunks chunks are in flight
+  at any time, so memory use is bounded by the chunk size rather than the
+  size of the file.
+
+  Each output line is the input line followed by one field per output
+  format. Rows that cannot be parsed get empty fields.
+
+  Formats are named as in \c CoordinateConversionConstants, and use the
+  options from \c CoordinateOptionDefaults.
+ */
+
+/*!
+  \brief Constructor.
+ */
+BulkCoordinateConverter::BulkCoordinateConverter() :
+  m_spatialReference(SpatialReference::wgs84()),
+  m_maxPendingChunks(std::max(1, QThread::idealThreadCount()) * 2)
+{
+}
+
+/*!
+  \brief Destructor.
+ */
+BulkCoordinateConverter::~BulkCoordinateConverter()
+{
+}
+
+/*!
+  \brief Returns the names of the supported formats.
+ */
+QStringList BulkCoordinateConverter::formatNames()
+{
+  using namespace CoordinateConversionConstants;
+  return { DECIMAL_DEGREES_FORMAT,
+           DEGREES_DECIMAL_MINUTES_FORMAT,
+           DEGREES_MINUTES_SECONDS_FORMAT,
+           GARS_FORMAT,
+           GEOREF_FORMAT,
+           MGRS_FORMAT,
+           USNG_FORMAT,
+           UTM_FORMAT };
+}
+
+/*!
+  \brief Returns a new option for the format called \a name, compared
+  case-insensitively, or \c nullptr if there is no such format.
+
+  \list
+  \li \a parent Owning parent QObject.
+  \endlist
+ */
+CoordinateConversionOption* BulkCoordinateConverter::createOption(const QString& name, QObject* parent)
+{
+  using namespace CoordinateConversionConstants;
+  auto is = [&name](const QString& format)
+  {
+    return name.compare(format, Qt::CaseInsensitive) == 0;
+  };
+
+  if (is(DECIMAL_DEGREES_FORMAT))
+    return createDecimalDegrees(parent);
+  else if (is(DEGREES_DECIMAL_MINUTES_FORMAT))
+    return createDegreesDecimalMinutes(parent);
+  else if (is(DEGREES_MINUTES_SECONDS_FORMAT))
+    return createDegreesMinutesSeconds(parent);
+  else if (is(GARS_FORMAT))
+    return createGars(GarsConversionMode::Center, parent);
+  else if (is(MGRS_FORMAT))
+    return createMgrs(MgrsConversionMode::Automatic, parent);
+  else if (is(USNG_FORMAT))
+    return createUsng(7, true, parent);
+  else if (is(UTM_FORMAT))
+    return createUtm(UtmConversionMode::NorthSouthIndicators, true, parent);
+
+  if (is(GEOREF_FORMAT))
+  {
+    // There is no default GeoRef option.
+    auto option = new CoordinateConversionOption(parent);
+    option->setName(GEOREF_FORMAT);
+    option->setOutputMode(CoordinateConversionOption::CoordinateType::GeoRef);
+    return option;
+  }
+
+  return nullptr;
+}
+
+/*!
+  \brief Sets the format of the notations read from the input to \a name.
+
+  Returns \c false if \a name is not a supported format.
+ */
+bool BulkCoordinateConverter::setInputFormat(const QString& name)
+{
+  std::unique_ptr<CoordinateConversionOption> option(createOption(name));
+  if (!option)
+    return false;
+
+  m_inputSpec = option->spec();
+  m_hasInputFormat = true;
+  return true;
+}
+
+/*!
+  \brief Sets the formats appended to each line of the output to \a names.
+
+  Returns \c false, and leaves the formats unchanged, if any name is not a
+  supported format.
+ */
+bool BulkCoordinateConverter::setOutputFormats(const QStringList& names)
+{
+  QStringList outputNames;
+  QVector<CoordinateFormatSpec> outputSpecs;
+  for (const auto& name : names)
+  {
+    std::unique_ptr<CoordinateConversionOption> option(createOption(name));
+    if (!option)
+      return false;
+
+    outputNames.append(option->name());
+    outputSpecs.append(option->spec());
+  }
+
+  m_outputNames = outputNames;
+  m_outputSpecs = outputSpecs;
+  return true;
+}
+
+/*!
+  \brief Sets the spatial reference of the parsed points to
+  \a spatialReference. Defaults to WGS84.
+ */
+void BulkCoordinateConverter::setSpatialReference(const SpatialReference& spatialReference)
+{
+  m_spatialReference = spatialReference;
+}
+
+/*!
+  \brief Sets the zero-based index of the field holding the input notation
+  to \a column. Defaults to 0.
+ */
+void BulkCoordinateConverter::setColumn(int column)
+{
+  m_column = std::max(0, column);
+}
+
+/*!
+  \brief Sets the field delimiter to \a delimiter. Defaults to a comma.
+ */
+void BulkCoordinateConverter::setDelimiter(char delimiter)
+{
+  m_delimiter = delimiter;
+}
+
+/*!
+  \brief Sets whether the first line of the input is a header to
+  \a hasHeader. The header is extended with the output format names.
+ */
+void BulkCoordinateConverter::setHasHeader(bool hasHeader)
+{
+  m_hasHeader = hasHeader;
+}
+
+/*!
+  \brief Sets the approximate size of a chunk of input to \a bytes.
+  Chunks are extended to the end of their last line. Defaults to 4MiB.
+ */
+void BulkCoordinateConverter::setChunkSize(int bytes)
+{
+  m_chunkSize = std::max(1, bytes);
+}
+
+/*!
+  \brief Sets the maximum number of chunks being converted or waiting to be
+  written to \a count. Defaults to twice the number of cores.
+ */
+void BulkCoordinateConverter::setMaxPendingChunks(int count)
+{
+  m_maxPendingChunks = std::max(1, count);
+}
+
+/*!
+  \brief Sets the function called about once a second, and once at the
+  end, with the statistics so far to \a callback.
+ */
+void BulkCoordinateConverter::setProgressCallback(ProgressCallback callback)
+{
+  m_progressCallback = std::move(callback);
+}
+
+/*!
+  \brief Converts every line of \a input and writes the result to
+  \a output.
+
+  Returns \c false, and sets \a errorMessage if it is not \c nullptr, if
+  the input could not be mapped or the output could not be written.
+ */
+bool BulkCoordinateConverter::convert(QFile& input, QIODevice& output, QString* errorMessage)
+{
+  auto fail = [errorMessage](const QString& message)
+  {
+    if (errorMessage)
+      *errorMessage = message;
+
+    return false;
+  };
+
+  m_statistics = Statistics();
+  if (!m_hasInputFormat || m_outputSpecs.isEmpty())
+    return fail(QStringLiteral("No input or output format set."));
+
+  const qint64 size = input.size();
+  if (size == 0)
+    return true;
+
+  auto data = reinterpret_cast<const char*>(input.map(0, size));
+  if (!data)
+    return fail(QStringLiteral("Cannot map %1: %2").arg(input.fileName(), input.errorString()));
+
+  const char* end = data + size;
+  const char* offset = data;
+
+  QElapsedTimer timer;
+  timer.start();
+  qint64 lastProgress = 0;
+
+  if (m_hasHeader)
+  {
+    const char* next = nullptr;
+    const char* last = lineEnd(offset, end, &next);
+    QByteArray header(offset, static_cast<int>(last - offset));
+    for (const auto& name : m_outputNames)
+      appendField(header, name.toUtf8());
+
+    header.append('\n');
+    if (output.write(header) != header.size())
+      return fail(QStringLiteral("Cannot write output: %1").arg(output.errorString()));
+
+    m_statistics.bytes += next - offset;
+    offset = next;
+  }
+
+  QQueue<QFuture<ChunkResult>> pending;
+  bool ok = true;
+  while (ok && (offset < end || !pending.isEmpty()))
+  {
+    while (offset < end && pending.size() < m_maxPendingChunks)
+    {
+      const char* chunkEnd = end;
+      if (end - offset > m_chunkSize)
+      {
+        auto newline = static_cast<const char*>(std::memchr(offset + m_chunkSize, '\n', end - offset - m_chunkSize));
+        chunkEnd = newline ? newline + 1 : end;
+      }
+
+      pending.enqueue(QtConcurrent::run([this, offset, chunkEnd]()
+      {
+        return convertChunk(offset, chunkEnd);
+      }));
+      m_statistics.bytes += chunkEnd - offset;
+      offset = chunkEnd;
+    }
+
+    const auto result = pending.dequeue().result();
+    if (output.write(result.text) != result.text.size())
+    {
+      ok = fail(QStringLiteral("Cannot write output: %1").arg(output.errorString()));
+      break;
+    }
+
+    m_statistics.rows += result.rows;
+    m_statistics.failures += result.failures;
+    m_statistics.elapsedMilliseconds = timer.elapsed();
+    if (m_progressCallback && m_statistics.elapsedMilliseconds - lastProgress >= PROGRESS_INTERVAL)
+    {
+      lastProgress = m_statistics.elapsedMilliseconds;
+      m_progressCallback(m_statistics);
+    }
+  }
+
+  // Chunks still in flight read from the mapping.
+  for (auto& future : pending)
+    future.waitForFinished();
+
+  input.unmap(reinterpret_cast<uchar*>(const_cast<char*>(data)));
+
+  m_statistics.elapsedMilliseconds = timer.elapsed();
+  if (m_progressCallback)
+    m_progressCallback(m_statistics);
+
+  return ok;
+}
+
+/*!
+  \brief Returns the statistics of the last conversion.
+ */
+BulkCoordinateConverter::Statistics BulkCoordinateConverter::statistics() const
+{
+  return m_statistics;
+}
+
+/*!
+  \internal
+  \brief Converts the lines from \a begin to \a end. Called on a worker
+  thread.
+ */
+BulkCoordinateConverter::ChunkResult BulkCoordinateConverter::convertChunk(const char* begin, const char* end) const
+{
+  QList<Point> points;
+  QVector<std::pair<const char*, const char*>> lines;
+  for (const char* p = begin; p < end;)
+  {
+    const char* next = nullptr;
+    const char* last = lineEnd(p, end, &next);
+    lines.append({ p, last });
+
+    const auto notation = QString::fromUtf8(field(p, last)).trimmed();
+    points.append(notation.isEmpty() ? Point() : parseCoordinate(m_inputSpec, notation, m_spatialReference));
+    p = next;
+  }
+
+  QVector<QStringList> notations;
+  notations.reserve(m_outputSpecs.size());
+  for (const auto& spec : m_outputSpecs)
+    notations.append(formatCoordinates(spec, points));
+
+  ChunkResult result;
+  result.rows = lines.size();
+  result.text.reserve(static_cast<int>((end - begin) * 2));
+  for (int i = 0; i < lines.size(); ++i)
+  {
+    result.text.append(lines[i].first, static_cast<int>(lines[i].second - lines[i].first));
+    const bool failed = points.at(i).isEmpty();
+    if (failed)
+      ++result.failures;
+
+    for (const auto& column : notations)
+      appendField(result.text, failed ? QByteArray() : column.at(i).toUtf8());
+
+    result.text.append('\n');
+  }
+  return result;
+}
+
+/*!
+  \internal
+  \brief Returns the input field of the line from \a begin to \a end, with
+  surrounding quotes removed and doubled quotes collapsed.
+ */
+QByteArray BulkCoordinateConverter::field(const char* begin, const char* end) const
+{
+  int column = 0;
+  const char* p = begin;
+  while (p < end)
+  {
+    QByteArray value;
+    if (*p == '"')
+    {
+      for (++p; p < end; ++p)
+      {
+        if (*p == '"')
+        {
+          if (p + 1 < end && *(p + 1) == '"')
+            ++p;
+          else
+            break;
+        }
+        value.append(*p);
+      }
+      p = std::find(p, end, m_delimiter);
+    }
+    else
+    {
+      const char* delimiter = std::find(p, end, m_delimiter);
+      value = QByteArray(p, static_cast<int>(delimiter - p));
+      p = delimiter;
+    }
+
+    if (column == m_column)
+      return value;
+
+    ++column;
+    if (p < end)
+      ++p;
+  }
+  return QByteArray();
+}
+
+/*!
+  \internal
+  \brief Appends a delimiter and \a value to \a text, quoting \a value if
+  it contains the delimiter or a quote.
+ */
+void BulkCoordinateConverter::appendField(QByteArray& text, const QByteArray& value) const
+{
+  text.append(m_delimiter);
+  if (!value.contains(m_delimiter) && !value.contains('"'))
+  {
+    text.append(value);
+    return;
+  }
+
+  text.append('"');
+  for (const char c : value)
+  {
+    if (c == '"')
+      text.append('"');
+
+    text.append(c);
+  }
+  text.append('"');
+}
+
+} // Toolkit
+} // ArcGISRuntime
+} // Esri
@@ -0,0 +1,121 @@
+/*******************************************************************************
+ *  Copyright 2012-2020 Esri
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+#ifndef BULKCOORDINATECONVERTER_H
+#define BULKCOORDINATECONVERTER_H
+
+// Toolkit headers
+#include "CoordinateFormatSpec.h"
+
+// Qt headers
+#include <QByteArray>
+#include <QIODevice>
+#include <QStringList>
+#include <QVector>
+
+// ArcGISRuntime headers
+#include <SpatialReference.h>
+
+// std headers
+#include <functional>
+
+class QFile;
+
+namespace Esri
+{
+namespace ArcGISRuntime
+{
+namespace Toolkit
+{
+
+class CoordinateConversionOption;
+
+class BulkCoordinateConverter
+{
+public:
+  struct Statistics
+  {
+    qint64 rows = 0;
+    qint64 failures = 0;
+    qint64 bytes = 0;
+    qint64 elapsedMilliseconds = 0;
+  };
+
+  using ProgressCallback = std::function<void(const Statistics&)>;
+
+  BulkCoordinateConverter();
+
+  ~BulkCoordinateConverter();
+
+  static QStringList formatNames();
+
+  static CoordinateConversionOption* createOption(const QString& name, QObject* parent = nullptr);
+
+  bool setInputFormat(const QString& name);
+
+  bool setOutputFormats(const QStringList& names);
+
+  void setSpatialReference(const SpatialReference& spatialReference);
+
+  void setColumn(int column);
+
+  void setDelimiter(char delimiter);
+
+  void setHasHeader(bool hasHeader);
+
+  void setChunkSize(int bytes);
+
+  void setMaxPendingChunks(int count);
+
+  void setProgressCallback(ProgressCallback callback);
+
+  bool convert(QFile& input, QIODevice& output, QString* errorMessage = nullptr);
+
+  Statistics statistics() const;
+
+private:
+  struct ChunkResult
+  {
+    QByteArray text;
+    qint64 rows = 0;
+    qint64 failures = 0;
+  };
+
+  ChunkResult convertChunk(const char* begin, const char* end) const;
+
+  QByteArray field(const char* begin, const char* end) const;
+
+  void appendField(QByteArray& text, const QByteArray& value) const;
+
+private:
+  bool m_hasInputFormat = false;
+  CoordinateFormatSpec m_inputSpec;
+  QStringList m_outputNames;
+  QVector<CoordinateFormatSpec> m_outputSpecs;
+  SpatialReference m_spatialReference;
+  int m_column = 0;
+  char m_delimiter = ',';
+  bool m_hasHeader = false;
+  int m_chunkSize = 4 * 1024 * 1024;
+  int m_maxPendingChunks = 0;
+  ProgressCallback m_progressCallback;
+  Statistics m_statistics;
+};
+
+} // Toolkit
+} // ArcGISRuntime
+} // Esri
+
+#endif // BULKCOORDINATECONVERTER_H
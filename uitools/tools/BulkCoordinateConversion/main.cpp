@@ -0,0 +1,158 @@
+/*******************************************************************************
+ *  Copyright 2012-2020 Esri
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ******************************************************************************/
+
+// Converts a column of coordinate notations in a delimited text file, for
+// example a CSV export, to one or more other notations.
+//
+//   BulkCoordinateConversion --from DMS --to MGRS,UTM --header in.csv out.csv
+
+#include "BulkCoordinateConverter.h"
+
+// Qt headers
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QFile>
+
+// std headers
+#include <cstdio>
+
+using namespace Esri::ArcGISRuntime;
+using namespace Esri::ArcGISRuntime::Toolkit;
+
+namespace
+{
+
+double rowsPerSecond(const BulkCoordinateConverter::Statistics& statistics)
+{
+  return statistics.elapsedMilliseconds > 0 ? statistics.rows * 1000.0 / statistics.elapsedMilliseconds : 0.0;
+}
+
+}
+
+int main(int argc, char* argv[])
+{
+  QCoreApplication app(argc, argv);
+  QCoreApplication::setApplicationName("BulkCoordinateConversion");
+
+  const QString formats = BulkCoordinateConverter::formatNames().join(", ");
+
+  QCommandLineParser parser;
+  parser.setApplicationDescription("Converts a column of coordinate notations in a delimited text file. "
+                                   "Each output line is the input line followed by one field per output format.");
+  parser.addHelpOption();
+  parser.addPositionalArgument("input", "The file to convert.");
+  parser.addPositionalArgument("output", "The file to write. Defaults to the standard output.", "[output]");
+
+  const QCommandLineOption fromOption({ "f", "from" }, QString("Input format, one of %1.").arg(formats), "format", "DD");
+  const QCommandLineOption toOption({ "t", "to" }, "Comma-separated output formats.", "formats", "MGRS");
+  const QCommandLineOption wkidOption("wkid", "Spatial reference of the parsed points.", "wkid", "4326");
+  const QCommandLineOption columnOption({ "c", "column" }, "Zero-based field holding the input notation.", "column", "0");
+  const QCommandLineOption delimiterOption({ "d", "delimiter" }, "Field delimiter.", "character", ",");
+  const QCommandLineOption headerOption("header", "The first line is a header.");
+  const QCommandLineOption chunkOption("chunk-size", "Approximate chunk size in KiB.", "kib", "4096");
+  const QCommandLineOption pendingOption("max-pending", "Maximum chunks in flight. Defaults to twice the number of cores.", "count");
+  const QCommandLineOption quietOption({ "q", "quiet" }, "Do not report progress.");
+  parser.addOptions({ fromOption, toOption, wkidOption, columnOption, delimiterOption,
+                      headerOption, chunkOption, pendingOption, quietOption });
+  parser.process(app);
+
+  const auto arguments = parser.positionalArguments();
+  if (arguments.isEmpty() || arguments.size() > 2)
+    parser.showHelp(1);
+
+  BulkCoordinateConverter converter;
+  if (!converter.setInputFormat(parser.value(fromOption)))
+  {
+    std::fprintf(stderr, "Unknown input format %s. Expected one of %s.\n",
+                 qPrintable(parser.value(fromOption)), qPrintable(formats));
+    return 1;
+  }
+
+  if (!converter.setOutputFormats(parser.value(toOption).split(',', Qt::SkipEmptyParts)))
+  {
+    std::fprintf(stderr, "Unknown output format in %s. Expected some of %s.\n",
+                 qPrintable(parser.value(toOption)), qPrintable(formats));
+    return 1;
+  }
+
+  const QString delimiter = parser.value(delimiterOption);
+  if (delimiter.size() != 1 || delimiter.at(0).unicode() > 127)
+  {
+    std::fprintf(stderr, "The delimiter must be a single ASCII character.\n");
+    return 1;
+  }
+
+  converter.setSpatialReference(SpatialReference(parser.value(wkidOption).toInt()));
+  converter.setColumn(parser.value(columnOption).toInt());
+  converter.setDelimiter(delimiter.at(0).toLatin1());
+  converter.setHasHeader(parser.isSet(headerOption));
+  converter.setChunkSize(parser.value(chunkOption).toInt() * 1024);
+  if (parser.isSet(pendingOption))
+    converter.setMaxPendingChunks(parser.value(pendingOption).toInt());
+
+  if (!parser.isSet(quietOption))
+  {
+    converter.setProgressCallback([](const BulkCoordinateConverter::Statistics& statistics)
+    {
+      std::fprintf(stderr, "\r%lld rows, %.0f rows/s", statistics.rows, rowsPerSecond(statistics));
+    });
+  }
+
+  QFile input(arguments.at(0));
+  if (!input.open(QIODevice::ReadOnly))
+  {
+    std::fprintf(stderr, "Cannot open %s: %s\n", qPrintable(input.fileName()), qPrintable(input.errorString()));
+    return 1;
+  }
+
+  QFile output;
+  bool opened = false;
+  if (arguments.size() > 1)
+  {
+    output.setFileName(arguments.at(1));
+    opened = output.open(QIODevice::WriteOnly);
+  }
+  else
+  {
+    opened = output.open(stdout, QIODevice::WriteOnly);
+  }
+
+  if (!opened)
+  {
+    std::fprintf(stderr, "Cannot open output: %s\n", qPrintable(output.errorString()));
+    return 1;
+  }
+
+  QString errorMessage;
+  const bool ok = converter.convert(input, output, &errorMessage);
+  output.close();
+
+  const auto statistics = converter.statistics();
+  if (!parser.isSet(quietOption))
+  {
+    std::fprintf(stderr, "\n%lld rows (%lld failed) in %.1fs, %.0f rows/s\n",
+                 statistics.rows, statistics.failures, statistics.elapsedMilliseconds / 1000.0,
+                 rowsPerSecond(statistics));
+  }
+
+  if (!ok)
+  {
+    std::fprintf(stderr, "%s\n", qPrintable(errorMessage));
+    return 1;
+  }
+
+  return 0;
+}
@@ -35,9 +35,6 @@
 #include <QItemDelegate>
 #include <QMenu>
 
-// std headers
-#include <cmath>
-
 namespace Esri
 {
 namespace ArcGISRuntime
@@ -195,13 +192,13 @@ void CoordinateConversion::flash()
     return;
 
   const auto point = m_controller->screenCoordinate();
-  if (point.isNull() || isnan(point.x()) || isnan(point.y()))
+  if (point.isNull() || point == QPointF(-1.0, -1.0))
     return;
 
   m_flash = new Flash();
   m_flash->setRadius(8);
   m_flash->setTargetColor(QApplication::palette().color(QPalette::Highlight));
-  m_flash->setPoint(m_controller->screenCoordinate());
+  m_flash->setPoint(point);
   m_flash->play(750);
   graphicsView->scene()->addWidget(m_flash.data());
 }
@@ -18,11 +18,21 @@
 // Toolkit headers
 #include "CoordinateConversionResult.h"
 #include "CoordinateConversionController.h"
+#include "CoordinateFormatSpec.h"
 #include "Internal/GenericListModel.h"
 #include "Internal/GenericTableProxyModel.h"
 
 //Qt headers
+#include <QFutureWatcher>
 #include <QLineEdit>
+#include <QTimer>
+#include <QtConcurrent>
+
+// ArcGISRuntime headers
+#include <GeoView.h>
+
+// std headers
+#include <algorithm>
 
 namespace Esri
 {
@@ -31,6 +41,32 @@ namespace ArcGISRuntime
 namespace Toolkit
 {
 
+namespace
+{
+
+constexpr int PARSED_POINTS_CAPACITY = 64;
+
+// Name of the dynamic property of an editor holding the latest parse request.
+constexpr char PARSE_GENERATION[] = "_esriParseGeneration";
+
+// Returns the key of a parse of \a text with \a spec into
+// \a spatialReference. The key covers every setting of the spec which
+// parseCoordinate reads, so options with equal settings share parses.
+QString parseKey(const CoordinateFormatSpec& spec,
+                 const SpatialReference& spatialReference,
+                 const QString& text)
+{
+  return QStringLiteral("%1:%2:%3:%4:%5:%6")
+      .arg(static_cast<int>(spec.outputMode()))
+      .arg(static_cast<int>(spec.mgrsConversionMode()))
+      .arg(static_cast<int>(spec.utmConversionMode()))
+      .arg(static_cast<int>(spec.garsConversionMode()))
+      .arg(spatialReference.isEmpty() ? 0 : spatialReference.wkid())
+      .arg(text);
+}
+
+}
+
 /*!
    \internal
    \class Esri::ArcGISRuntime::Toolkit::CoordinateEditDelegate
@@ -41,6 +77,13 @@ namespace Toolkit
    When a coordinate is edited by the user, this tool triggers an update of the
    current point on the controller, as opposed to just editing the value in
    the cell as would normally happen.
+
+   The text is parsed while the user types. Once typing pauses for
+   \l parseDelay milliseconds, the text is parsed on the global thread pool
+   and the editor shows it in red if it is not a valid coordinate. Parses
+   superseded by newer text are discarded. Recent parses are cached, so
+   committing an edit reuses the point parsed while typing instead of parsing
+   the text again.
  */
 
  /*!
@@ -50,7 +93,8 @@ namespace Toolkit
     \endlist
   */
 CoordinateEditDelegate::CoordinateEditDelegate(QObject* parent):
-  QItemDelegate(parent) 
+  QItemDelegate(parent),
+  m_parsedPoints(PARSED_POINTS_CAPACITY)
 {
 }
 
@@ -83,6 +127,69 @@ CoordinateConversionController* CoordinateEditDelegate::controller() const
   return m_controller;
 }
 
+/*!
+  \brief Set how long typing must pause, in milliseconds, before the text of
+  an editor is parsed to \a milliseconds.
+ */
+void CoordinateEditDelegate::setParseDelay(int milliseconds)
+{
+  m_parseDelay = std::max(0, milliseconds);
+}
+
+/*!
+  \brief Returns how long typing must pause, in milliseconds, before the
+  text of an editor is parsed. Defaults to 250.
+ */
+int CoordinateEditDelegate::parseDelay() const
+{
+  return m_parseDelay;
+}
+
+/*!
+  \brief Creates the editor for \a index, and parses its text in the
+  background as the user types.
+  \list
+    \li \a parent Parent of the editor.
+    \li \a option Style options of the item.
+    \li \a index Index of the item to edit.
+  \endlist
+ */
+QWidget* CoordinateEditDelegate::createEditor(
+  QWidget* parent,
+  const QStyleOptionViewItem& option,
+  const QModelIndex& index) const
+{
+  auto editor = QItemDelegate::createEditor(parent, option, index);
+  auto lineEdit = qobject_cast<QLineEdit*>(editor);
+  auto tableModel = qobject_cast<const GenericTableProxyModel*>(index.model());
+  if (!lineEdit || !tableModel || !m_controller)
+    return editor;
+
+  auto result = tableModel->sourceModel()->element<CoordinateConversionResult>(index);
+  if (!result || !result->type())
+    return editor;
+
+  QPointer<CoordinateConversionOption> type = result->type();
+  auto timer = new QTimer(lineEdit);
+  timer->setSingleShot(true);
+  timer->setInterval(m_parseDelay);
+
+  connect(lineEdit, &QLineEdit::textEdited, timer, [lineEdit, timer]
+  {
+    // Invalidate any parse in flight; its text is out of date.
+    lineEdit->setProperty(PARSE_GENERATION, lineEdit->property(PARSE_GENERATION).toULongLong() + 1);
+    timer->start();
+  });
+
+  connect(timer, &QTimer::timeout, lineEdit, [this, lineEdit, type]
+  {
+    if (type)
+      parse(lineEdit, type, lineEdit->property(PARSE_GENERATION).toULongLong());
+  });
+
+  return editor;
+}
+
 /*!
   \brief Called when the user commits data to the model.
   \list
@@ -112,8 +219,17 @@ void CoordinateEditDelegate::setModelData(
   {
     // Only commit if text differs - otherwise what looks like a
     // non-change will cause a change due to differences in format accuracies.
-    if (result->notation() != lineEdit->text())
-      m_controller->setCurrentPoint(lineEdit->text(), result->type());
+    const auto text = lineEdit->text();
+    if (result->notation() == text)
+      return;
+
+    // Reuse the point parsed while typing, if it is still cached.
+    auto type = result->type();
+    const auto point = type ? m_parsedPoints.object(parseKey(type->spec(), spatialReference(), text)) : nullptr;
+    if (!point)
+      m_controller->setCurrentPoint(text, type);
+    else if (point->isValid())
+      m_controller->setCurrentPoint(*point);
   }
   else
   {
@@ -121,6 +237,85 @@ void CoordinateEditDelegate::setModelData(
   }
 }
 
+/*!
+  \internal
+  \brief Returns the spatial reference text is parsed into, which is that
+  of the controller's \c GeoView, as in
+  \c CoordinateConversionController::setCurrentPoint.
+ */
+SpatialReference CoordinateEditDelegate::spatialReference() const
+{
+  if (m_controller)
+  {
+    if (auto geoView = qobject_cast<GeoView*>(m_controller->geoView()))
+      return geoView->spatialReference();
+  }
+  return SpatialReference();
+}
+
+/*!
+  \internal
+  \brief Parses the text of \a lineEdit with \a option on the global thread
+  pool, as request \a generation of the editor.
+
+  The result is cached, and only shown if no newer text was typed in the
+  meantime.
+ */
+void CoordinateEditDelegate::parse(QLineEdit* lineEdit, CoordinateConversionOption* option, quint64 generation) const
+{
+  const auto text = lineEdit->text();
+  const auto spatialReference = this->spatialReference();
+  const auto spec = option->spec();
+  const auto key = parseKey(spec, spatialReference, text);
+  if (auto point = m_parsedPoints.object(key))
+  {
+    showParseResult(lineEdit, option, *point);
+    return;
+  }
+
+  auto watcher = new QFutureWatcher<Point>(lineEdit);
+  QPointer<CoordinateConversionOption> type = option;
+  connect(watcher, &QFutureWatcherBase::finished, lineEdit, [this, lineEdit, watcher, type, key, generation]
+  {
+    watcher->deleteLater();
+    const auto point = watcher->result();
+    m_parsedPoints.insert(key, new Point(point));
+
+    if (type && lineEdit->property(PARSE_GENERATION).toULongLong() == generation)
+      showParseResult(lineEdit, type, point);
+  });
+
+  // The worker captures the option's formatting as a spec rather than the
+  // option itself, so it never touches a QObject owned by the GUI thread.
+  // Keep it that way when changing the capture list; nothing checks it.
+  watcher->setFuture(QtConcurrent::run([spec, text, spatialReference]
+  {
+    return parseCoordinate(spec, text, spatialReference);
+  }));
+}
+
+/*!
+  \internal
+  \brief Shows in \a lineEdit whether its text parsed with \a option into
+  a valid \a point.
+ */
+void CoordinateEditDelegate::showParseResult(QLineEdit* lineEdit, const CoordinateConversionOption* option, const Point& point) const
+{
+  if (point.isValid())
+  {
+    // An empty palette falls back to the inherited one.
+    lineEdit->setPalette(QPalette());
+    lineEdit->setToolTip(QString());
+  }
+  else
+  {
+    auto palette = lineEdit->palette();
+    palette.setColor(QPalette::Text, Qt::red);
+    lineEdit->setPalette(palette);
+    lineEdit->setToolTip(tr("Not a valid %1 coordinate").arg(option->name()));
+  }
+}
+
 } // Toolkit
 } // ArcGISRuntime
 } // Esri
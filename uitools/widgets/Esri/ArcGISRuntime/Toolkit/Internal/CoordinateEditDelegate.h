@@ -17,8 +17,17 @@
 #define ESRI_ARCGISRUNTIME_TOOLKIT_INTERNAL_COORDIANTEEDITDELEGATE_H
 
 // Qt headers
+#include <QCache>
 #include <QItemDelegate>
 #include <QPointer>
+#include <QString>
+
+// ArcGISRuntime headers
+#include <Point.h>
+#include <SpatialReference.h>
+
+// Qt forward declarations
+class QLineEdit;
 
 namespace Esri
 {
@@ -28,6 +37,7 @@ namespace Toolkit
 {
 
 class CoordinateConversionController;
+class CoordinateConversionOption;
 
 class CoordinateEditDelegate : public QItemDelegate
 {
@@ -41,11 +51,27 @@ public:
 
   CoordinateConversionController* controller() const;
 
+  void setParseDelay(int milliseconds);
+
+  int parseDelay() const;
+
+  QWidget* createEditor(QWidget* parent, const QStyleOptionViewItem& option,
+                        const QModelIndex& index) const override;
+
   void setModelData(QWidget* editor, QAbstractItemModel* model,
                     const QModelIndex& index) const override;
 
+private:
+  SpatialReference spatialReference() const;
+
+  void parse(QLineEdit* lineEdit, CoordinateConversionOption* option, quint64 generation) const;
+
+  void showParseResult(QLineEdit* lineEdit, const CoordinateConversionOption* option, const Point& point) const;
+
 private:
   QPointer<CoordinateConversionController> m_controller;
+  int m_parseDelay = 250;
+  mutable QCache<QString, Point> m_parsedPoints;
 };
 
 } // Toolkit